@@ -76,6 +76,12 @@ FLINT_DLL int is_mul_coprime_ui_ui(ulong x, ulong y, const fmpz_t n);
 
 FLINT_DLL int is_mul_coprime_ui_fmpz(ulong x, const fmpz_t y, const fmpz_t n);
 
+/* Parallel loops */
+
+typedef int (*_aprcl_worker_fn)(void * arg, slong i);
+
+FLINT_DLL int _aprcl_parallel_for(slong len, _aprcl_worker_fn fn, void * arg);
+
 /* 
                             Primality tests
 --------------------------------------------------------------------------------
@@ -9,24 +9,40 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include "thread_pool.h"
 #include "aprcl.h"
 
-int
-is_prime_final_division(const fmpz_t n, const fmpz_t s, ulong r)
+/* number of residues checked by each task in the threaded version */
+#define FINAL_DIVISION_CHUNK 1024
+
+/*
+    Checks the residues n^i mod s for start <= i <= stop. Returns 0 if one
+    of them is a proper divisor of n; otherwise returns 1. If n^i = 1 mod s
+    for some i in the range, the later residues repeat the earlier ones, so
+    the search stops and *order is lowered to i.
+*/
+static int
+_is_prime_final_division_range(const fmpz_t n, const fmpz_t s,
+                               ulong start, ulong stop, volatile ulong * order)
 {
     int result = 1;
     ulong i;
     fmpz_t npow, nmul, rem;
 
     fmpz_init(rem);
-    fmpz_init_set(npow, n);
-    fmpz_mod(npow, npow, s); /* npow = n mod s */
-    fmpz_init_set(nmul, npow);
+    fmpz_init(npow);
+    fmpz_init(nmul);
+    fmpz_mod(nmul, n, s); /* nmul = n mod s */
+    fmpz_powm_ui(npow, nmul, start, s); /* npow = n^start mod s */
 
-    for (i = 1; i <= r; i++)
+    for (i = start; i <= stop; i++)
     {
         if (fmpz_is_one(npow))
+        {
+            if (i < *order)
+                *order = i;
             break;
+        }
 
         fmpz_mod(rem, n, npow);
 
@@ -53,3 +69,46 @@ is_prime_final_division(const fmpz_t n, const fmpz_t s, ulong r)
 
     return result;
 }
+
+typedef struct
+{
+    const fmpz * n;
+    const fmpz * s;
+    ulong r;
+    volatile ulong order;
+}
+_final_division_arg_struct;
+
+static int
+_is_prime_final_division_worker(void * varg, slong j)
+{
+    _final_division_arg_struct * arg = (_final_division_arg_struct *) varg;
+    ulong start = j*FINAL_DIVISION_CHUNK + 1;
+    ulong stop = FLINT_MIN(start + FINAL_DIVISION_CHUNK - 1, arg->r);
+
+    /* the residues in this chunk have all been seen already */
+    if (start > arg->order)
+        return 0;
+
+    return !_is_prime_final_division_range(arg->n, arg->s,
+                                                   start, stop, &arg->order);
+}
+
+int
+is_prime_final_division(const fmpz_t n, const fmpz_t s, ulong r)
+{
+    _final_division_arg_struct arg;
+
+    arg.n = n;
+    arg.s = s;
+    arg.r = r;
+    arg.order = UWORD_MAX;
+
+    if (!global_thread_pool_initialized || r < 2*FINAL_DIVISION_CHUNK)
+        return _is_prime_final_division_range(n, s, 1, r, &arg.order);
+
+    /* the chunks of exponents are checked in parallel */
+    return !_aprcl_parallel_for((r + FINAL_DIVISION_CHUNK - 1)
+                      /FINAL_DIVISION_CHUNK,
+                      _is_prime_final_division_worker, &arg);
+}
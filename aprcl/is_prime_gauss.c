@@ -148,12 +148,141 @@ _is_gausspower_from_unity_p(ulong q, ulong r, const fmpz_t n)
     return result;
 }
 
+/*
+    A pair (q, p) with p | q - 1 whose checks are done as an independent
+    task. The task records in state which parts of (Lp) it proved for p,
+    with the same meaning as lambdas_p below; the states of all pairs with
+    the same p are combined with a bitwise or.
+*/
+typedef struct
+{
+    ulong q;
+    ulong p;
+    ulong exp;
+    int state;
+}
+_gauss_pair_struct;
+
+typedef struct
+{
+    const fmpz * n;
+    ulong nmod4;
+    _gauss_pair_struct * pairs;
+}
+_gauss_arg_struct;
+
+/*
+    Checks the pair i. Returns 1 if n was proved composite; otherwise
+    returns 0 and sets the state of the pair.
+*/
+static int
+_is_prime_gauss_pair(void * varg, slong i)
+{
+    _gauss_arg_struct * arg = (_gauss_arg_struct *) varg;
+    _gauss_pair_struct * pair = arg->pairs + i;
+    const fmpz * n = arg->n;
+    ulong k, p, q, nmod4 = arg->nmod4;
+    int state = 0;
+
+    q = pair->q;
+    p = pair->p;
+
+    /*
+        (Lp.a)
+        if p == 2 and n = 1 mod 4 then (Lp) is equal to:
+            for quadratic character \chi (\tau(\chi))^(\sigma_n-n) = -1
+    */
+    if (p == 2 && nmod4 == 1)
+    {
+        if (_is_gausspower_2q_equal_first(q, n) == 1)
+            state = 3;
+    }
+
+    /*
+        (Lp.b)
+        if p == 2, r = 2^k >= 4 and n = 3 mod 4 then (Lp) is equal to:
+            1) for quadratic character \chi 
+                (\tau(\chi^(r / 2)))^(\sigma_n-n) = -1
+            2) for character \chi = \chi_{r, q}
+                (\tau(\chi))^(\sigma_n-n) is a generator of cyclic 
+                group <\zeta_r>
+
+        if 1) is true, then lambdas_p = 1
+        if 2) is true, then lambdas_p = 2
+        if 1) and 2) is true, then lambdas_p = 3
+    */
+    if (p == 2 && nmod4 == 3)
+    {
+        if (_is_gausspower_2q_equal_second(q, n) == 1)
+            state = 1;
+    }
+
+    /* for every prime power p^k | q - 1 */
+    for (k = 1; k <= pair->exp; k++)
+    {
+        int unity_power;
+        ulong r;
+
+        /* r = p^k */
+        r = n_pow(p, k);
+
+        /* if gcd(q*r, n) != 1 */
+        if (is_mul_coprime_ui_ui(q, r, n) == 0)
+            return 1;
+
+        /* 
+            if exists z such that \tau(\chi^n) = \zeta_r^z*\tau^n(\chi) 
+            unity_power = z; otherwise unity_power = -1
+        */
+        unity_power = _is_gausspower_from_unity_p(q, r, n);
+
+        /* if unity_power < 0 then n is composite */
+        if (unity_power < 0)
+            return 1;
+
+        /*
+            (Lp.c)
+            if p > 2 then (Lp) is equal to:
+                (\tau(\chi))^(\sigma_n - n) is a generator of cyclic 
+                group <\zeta_r>
+        */
+        if (p > 2 && state == 0 && unity_power > 0)
+        {
+            ulong upow = unity_power;
+            /* 
+                if gcd(r, unity_power) = 1 then 
+                (\tau(\chi))^(\sigma_n - n) is a generator
+            */
+            if (n_gcd(r, upow) == 1)
+                state = 3;
+        }
+
+        /*
+            (Lp.b)
+            check 2) of (Lp) if p == 2 and nmod4 == 3
+        */
+        if (p == 2 && unity_power > 0 && nmod4 == 3)
+        {
+            ulong upow = unity_power;
+            if (n_gcd(r, upow) == 1)
+                state |= 2;
+        }
+    }
+
+    pair->state = state;
+
+    return 0;
+}
+
 primality_test_status
 _is_prime_gauss(const fmpz_t n, const aprcl_config config)
 {
     int *lambdas;
-    ulong i, j, k, nmod4;
+    ulong i, j, nmod4;
+    slong l, num_pairs, alloc;
     primality_test_status result;
+    _gauss_pair_struct * pairs;
+    _gauss_arg_struct arg;
 
     /* 
         Condition (Lp) is satisfied iff:
@@ -172,12 +301,15 @@ _is_prime_gauss(const fmpz_t n, const aprcl_config config)
     /* nmod4 = n % 4 */
     nmod4 = fmpz_tdiv_ui(n, 4);
 
-    /* for every prime q | s */
+    /* collect the pairs (q, p) with q | s and p | q - 1 */
+    num_pairs = 0;
+    alloc = 0;
+    pairs = NULL;
+
     for (i = 0; i < config->qs->num; i++)
     {
         n_factor_t q_factors;
         ulong q;
-        if (result == COMPOSITE) break;
 
         q = fmpz_get_ui(config->qs->p + i);
 
@@ -192,132 +324,41 @@ _is_prime_gauss(const fmpz_t n, const aprcl_config config)
         n_factor_init(&q_factors);
         n_factor(&q_factors, q - 1, 1);
 
-        /* for every prime p | q - 1 */
-        for (j = 0; j < q_factors.num; j++)
+        if (num_pairs + q_factors.num > alloc)
         {
-            int state, pind;
-            ulong p;
-            if (result == COMPOSITE) break;
+            alloc = FLINT_MAX(num_pairs + q_factors.num, 2*alloc);
+            pairs = (_gauss_pair_struct *) flint_realloc(pairs,
+                                         alloc*sizeof(_gauss_pair_struct));
+        }
 
-            p = q_factors.p[j];
+        for (j = 0; j < q_factors.num; j++)
+        {
+            pairs[num_pairs].q = q;
+            pairs[num_pairs].p = q_factors.p[j];
+            pairs[num_pairs].exp = q_factors.exp[j];
+            pairs[num_pairs].state = 0;
+            num_pairs++;
+        }
+    }
 
-            pind = _p_ind(config, p);
-            state = lambdas[pind];
+    /* the pairs are checked in parallel, stopping once n is composite */
+    if (result == PROBABPRIME)
+    {
+        arg.n = n;
+        arg.nmod4 = nmod4;
+        arg.pairs = pairs;
 
-            /*
-                (Lp.a)
-                if p == 2 and n = 1 mod 4 then (Lp) is equal to:
-                    for quadratic character \chi (\tau(\chi))^(\sigma_n-n) = -1
-            */
-            if (p == 2 && state == 0 && nmod4 == 1)
-            {
-                if (_is_gausspower_2q_equal_first(q, n) == 1)
-                {
-                    state = 3;
-                    lambdas[pind] = state;
-                }
-            }
-
-            /*
-                (Lp.b)
-                if p == 2, r = 2^k >= 4 and n = 3 mod 4 then (Lp) is equal to:
-                    1) for quadratic character \chi 
-                        (\tau(\chi^(r / 2)))^(\sigma_n-n) = -1
-                    2) for character \chi = \chi_{r, q}
-                        (\tau(\chi))^(\sigma_n-n) is a generator of cyclic 
-                        group <\zeta_r>
-
-                if 1) is true, then lambdas_p = 1
-                if 2) is true, then lambdas_p = 2
-                if 1) and 2) is true, then lambdas_p = 3
-            */
-            if (p == 2 && (state == 0 || state == 2) && nmod4 == 3)
-            {
-                if (_is_gausspower_2q_equal_second(q, n) == 1)
-                {
-                    if (state == 2)
-                        state = 3;
-                    else
-                        state = 1;
-                    lambdas[pind] = state;
-                }
-            }
-
-            /* for every prime power p^k | q - 1 */
-            for (k = 1; k <= q_factors.exp[j]; k++)
-            {
-                int unity_power;
-                ulong r;
-
-                /* r = p^k */
-                r = n_pow(p, k);
-
-                /* if gcd(q*r, n) != 1 */
-                if (is_mul_coprime_ui_ui(q, r, n) == 0)
-                {
-                    result = COMPOSITE;
-                    break;
-                }
-
-                /* 
-                    if exists z such that \tau(\chi^n) = \zeta_r^z*\tau^n(\chi) 
-                    unity_power = z; otherwise unity_power = -1
-                */
-                unity_power = _is_gausspower_from_unity_p(q, r, n);
-
-                /* if unity_power < 0 then n is composite */
-                if (unity_power < 0)
-                {
-                    result = COMPOSITE;
-                    break;
-                }
-
-                /*
-                    (Lp.c)
-                    if p > 2 then (Lp) is equal to:
-                        (\tau(\chi))^(\sigma_n - n) is a generator of cyclic 
-                        group <\zeta_r>
-                */
-                if (p > 2 && state == 0 && unity_power > 0)
-                {
-                    ulong upow = unity_power;
-                    /* 
-                        if gcd(r, unity_power) = 1 then 
-                        (\tau(\chi))^(\sigma_n - n) is a generator
-                    */
-                    if (n_gcd(r, upow) == 1)
-                    {
-                        state = 3;
-                        lambdas[pind] = state;
-                    }
-                }
-
-                /*
-                    (Lp.b)
-                    check 2) of (Lp) if p == 2 and nmod4 == 3
-                */
-                if (p == 2 && unity_power > 0 
-                    && (state == 0 || state == 1) && nmod4 == 3)
-                {
-                    ulong upow = unity_power;
-                    if (n_gcd(r, upow) == 1)
-                    {
-                        if (state == 0) 
-                        { 
-                            state = 2;
-                            lambdas[pind] = state;
-                        }
-                        if (state == 1)
-                        {
-                            state = 3;
-                            lambdas[pind] = state;
-                        }
-                    }
-                }
-            }
+        if (_aprcl_parallel_for(num_pairs, _is_prime_gauss_pair, &arg))
+            result = COMPOSITE;
+        else
+        {
+            for (l = 0; l < num_pairs; l++)
+                lambdas[_p_ind(config, pairs[l].p)] |= pairs[l].state;
         }
     }
 
+    flint_free(pairs);
+
     /* 
         if for some p we have not proved (Lp) 
         then n can be as prime or composite
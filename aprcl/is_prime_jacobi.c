@@ -535,13 +535,163 @@ _is_prime_jacobi_additional_test(const fmpz_t n, ulong p)
     return result;
 }
 
+/*
+    A pair (q, p) with p | q - 1 whose Jacobi sum check is done as an
+    independent task. The tasks only communicate through lambda, which is
+    set to 1 if the check proves (Lp) for p.
+*/
+typedef struct
+{
+    ulong q;
+    ulong p;
+    ulong k;
+    int lambda;
+}
+_jacobi_pair_struct;
+
+typedef struct
+{
+    const fmpz * n;
+    const fmpz * ndec;
+    const fmpz * ndecdiv;
+    ulong nmod4;
+    _jacobi_pair_struct * pairs;
+}
+_jacobi_arg_struct;
+
+/* larger prime powers first, so that the longest tasks start earliest */
+static int
+_jacobi_pair_cmp(const void * a, const void * b)
+{
+    ulong ra = n_pow(((const _jacobi_pair_struct *) a)->p,
+                     ((const _jacobi_pair_struct *) a)->k);
+    ulong rb = n_pow(((const _jacobi_pair_struct *) b)->p,
+                     ((const _jacobi_pair_struct *) b)->k);
+
+    return (ra < rb) - (ra > rb);
+}
+
+/*
+    Step (2.) for the pair i. Returns 1 if n was proved composite;
+    otherwise returns 0 and sets the lambda of the pair.
+*/
+static int
+_is_prime_jacobi_pair(void * varg, slong i)
+{
+    _jacobi_arg_struct * arg = (_jacobi_arg_struct *) varg;
+    _jacobi_pair_struct * pair = arg->pairs + i;
+    const fmpz * n = arg->n;
+    int composite;
+    slong h;
+    ulong v, p, q, r, k;
+    fmpz_t u, q_pow;
+    unity_zp jacobi_sum, jacobi_sum2_1, jacobi_sum2_2;
+
+    q = pair->q;
+    p = pair->p;            /* p | q - 1 */
+    k = pair->k;            /* max k for which p^k | q - 1 */
+    r = n_pow(p, k);        /* r = p^k */
+    composite = 0;
+
+    /* compute u = n / r and v = n % r */
+    fmpz_init(u);
+    fmpz_tdiv_q_ui(u, n, r);
+    v = fmpz_tdiv_ui(n, r);
+
+    /* init unity_zp for jacobi sums */
+    unity_zp_init(jacobi_sum, p, k, n);
+    unity_zp_init(jacobi_sum2_1, p, k, n);
+    unity_zp_init(jacobi_sum2_2, p, k, n);
+
+    /* compute set jacobi_sum = J(p, q) */
+    unity_zp_jacobi_sum_pq(jacobi_sum, q, p);
+    /* if p == 2 and k >= 3 we also need to compute J_2(q) and J_3(q) */
+    if (p == 2 && k >= 3)
+    {
+        /* compute J_3(q) */
+        unity_zp_jacobi_sum_2q_one(jacobi_sum2_1, q);
+        /* compute J_2(q) */
+        unity_zp_jacobi_sum_2q_two(jacobi_sum2_2, q);
+    }
+
+    if (p == 2 && k == 1)
+    {
+        h = _is_prime_jacobi_check_21(q, n);
+
+        /* if h not found then n is composite */
+        if (h < 0)
+            composite = 1;
+
+        /* 
+            check (Lp); 
+            if h == 1 (unity root = -1) 
+            and n % 4 == 1 then lambdas_2 = 1 
+        */
+        if (h == 1 && arg->nmod4 == 1)
+            pair->lambda = 1;
+    }
+    else if (p == 2)
+    {
+        if (k == 2)
+            h = _is_prime_jacobi_check_22(jacobi_sum, u, v, q);
+        else
+            h = _is_prime_jacobi_check_2k(jacobi_sum,
+                    jacobi_sum2_1, jacobi_sum2_2, u, v);
+
+        /* if h not found then n is composite */
+        if (h < 0)
+            composite = 1;
+
+        /* 
+            check (Lp); 
+            if h % 2 != 0 (primitive unity root) 
+            and q^{(n - 1) / 2} = -1 mod n then lambdas_2 = 1
+        */
+        else if (h % 2 != 0)
+        {
+            fmpz_init_set_ui(q_pow, q);
+            fmpz_powm(q_pow, q_pow, arg->ndecdiv, n);
+            if (fmpz_equal(q_pow, arg->ndec))
+                pair->lambda = 1;
+            fmpz_clear(q_pow);
+        }
+    }
+    else
+    {
+        h = _is_prime_jacobi_check_pk(jacobi_sum, u, v);
+
+        /* if h not found then n is composite */
+        if (h < 0)
+            composite = 1;
+
+        /* 
+            check (Lp); 
+            if h % p != 0 (primitive unity root) 
+            then lambdas_p = 1
+        */
+        else if (h % p != 0)
+            pair->lambda = 1;
+    }
+
+    /* clear unity_zp for jacobi sums */
+    unity_zp_clear(jacobi_sum);
+    unity_zp_clear(jacobi_sum2_1);
+    unity_zp_clear(jacobi_sum2_2);
+    fmpz_clear(u);
+
+    return composite;
+}
+
 primality_test_status
 _is_prime_jacobi(const fmpz_t n, const aprcl_config config)
 {
     int *lambdas;
     ulong i, j, nmod4;
+    slong l, num_pairs, alloc;
     primality_test_status result;
-    fmpz_t temp, p2, ndec, ndecdiv, u, q_pow;
+    fmpz_t temp, p2, ndec, ndecdiv;
+    _jacobi_pair_struct * pairs;
+    _jacobi_arg_struct arg;
 
     /* deal with primes that can divide R */
     if (fmpz_cmp_ui(n, 2) == 0)
@@ -551,8 +701,6 @@ _is_prime_jacobi(const fmpz_t n, const aprcl_config config)
        return PRIME;
 
     /* initialization */
-    fmpz_init(q_pow);
-    fmpz_init(u);
     fmpz_init(temp);
     fmpz_init(p2);
     fmpz_init(ndecdiv);
@@ -601,8 +749,13 @@ _is_prime_jacobi(const fmpz_t n, const aprcl_config config)
         result = COMPOSITE;
 
     /* Begin pseudoprime tests with Jacobi sums step. */
-    /* for every prime q | s */
-    for (i = 0; i < config->qs->num; i++)
+
+    /* collect the pairs (q, p) with q | s and p | q - 1 */
+    num_pairs = 0;
+    alloc = 0;
+    pairs = NULL;
+
+    for (i = 0; i < config->qs->num && result != COMPOSITE; i++)
     {
         n_factor_t q_factors;
         ulong q;
@@ -610,9 +763,6 @@ _is_prime_jacobi(const fmpz_t n, const aprcl_config config)
         if (config->qs_used[i] == 0)
             continue;
 
-        if (result == COMPOSITE)
-            break;
-
         q = fmpz_get_ui(config->qs->p + i); /* set q; q must get into ulong */
 
         /* if n == q; q - prime => n - prime */
@@ -626,124 +776,50 @@ _is_prime_jacobi(const fmpz_t n, const aprcl_config config)
         n_factor_init(&q_factors);
         n_factor(&q_factors, q - 1, 1);
 
-        /* for every prime p | q - 1 */
-        for (j = 0; j < q_factors.num; j++)
+        if (num_pairs + q_factors.num > alloc)
         {
-            int pind;
-            slong h;
-            ulong v, p, r, k;
-            unity_zp jacobi_sum, jacobi_sum2_1, jacobi_sum2_2;
-
-            if (result == COMPOSITE)
-                break;
-
-            p = q_factors.p[j];     /* set p; p | q - 1 */
-            k = q_factors.exp[j];   /* set max k for which p^k | q - 1 */
-            r = n_pow(p, k);        /* set r = p^k */
-            pind = _p_ind(config, p);  /* find index of p in lambdas */
-
-            /* if lambdas_p == 0 set q_pow = q^{(n - 1) / 2} and p == 2 */
-            fmpz_set_ui(q_pow, q);
-            if (lambdas[pind] == 0 && p == 2)
-                fmpz_powm(q_pow, q_pow, ndecdiv, n);
-
-            /* compute u = n / r and v = n % r */
-            fmpz_tdiv_q_ui(u, n, r);
-            v = fmpz_tdiv_ui(n, r);
-
-            /* init unity_zp for jacobi sums */
-            unity_zp_init(jacobi_sum, p, k, n);
-            unity_zp_init(jacobi_sum2_1, p, k, n);
-            unity_zp_init(jacobi_sum2_2, p, k, n);
-
-            /* compute set jacobi_sum = J(p, q) */
-            unity_zp_jacobi_sum_pq(jacobi_sum, q, p);
-            /* if p == 2 and k >= 3 we also need to compute J_2(q) and J_3(q) */
-            if (p == 2 && k >= 3)
-            {
-                /* compute J_3(q) */
-                unity_zp_jacobi_sum_2q_one(jacobi_sum2_1, q);
-                /* compute J_2(q) */
-                unity_zp_jacobi_sum_2q_two(jacobi_sum2_2, q);
-            }
-
-            if (p == 2 && k == 1)
-            {
-                h = _is_prime_jacobi_check_21(q, n);
-
-                /* if h not found then n is composite */
-                if (h < 0)
-                    result = COMPOSITE;
-
-                /* 
-                    check (Lp); 
-                    if h == 1 (unity root = -1) 
-                    and n % 4 == 1 then lambdas_2 = 1 
-                */
-                if (lambdas[pind] == 0 && h == 1 && nmod4 == 1)
-                    lambdas[pind] = 1;
-            }
-
-            if (p == 2 && k == 2)
-            {
-                h = _is_prime_jacobi_check_22(jacobi_sum, u, v, q);
-
-                /* if h not found then n is composite */
-                if (h < 0)
-                    result = COMPOSITE;
-
-                /* 
-                    check (Lp); 
-                    if h == 1 or 3 (unity root = -i or i) 
-                    and q^{(n - 1) / 2} = -1 mod n then lambdas_2 = 1
-                */
-                if (h % 2 != 0 && lambdas[pind] == 0 && fmpz_equal(q_pow, ndec))
-                    lambdas[pind] = 1;
-            }
-
-            if (p == 2 && k >= 3)
-            {
-                h = _is_prime_jacobi_check_2k(jacobi_sum,
-                        jacobi_sum2_1, jacobi_sum2_2, u, v);
-
-                /* if h not found then n is composite */
-                if (h < 0)
-                    result = COMPOSITE;
-
-                /* 
-                    check (Lp); 
-                    if h % 2 != 0 (primitive unity root) 
-                    and q^{(n - 1) / 2} = -1 mod n then lambdas_2 = 1
-                */
-                if (h % 2 != 0 && lambdas[pind] == 0 && fmpz_equal(q_pow, ndec))
-                    lambdas[pind] = 1;
-            }
+            alloc = FLINT_MAX(num_pairs + q_factors.num, 2*alloc);
+            pairs = (_jacobi_pair_struct *) flint_realloc(pairs,
+                                         alloc*sizeof(_jacobi_pair_struct));
+        }
 
-            if (p != 2)
-            {
-                h = _is_prime_jacobi_check_pk(jacobi_sum, u, v);
+        for (j = 0; j < q_factors.num; j++)
+        {
+            pairs[num_pairs].q = q;
+            pairs[num_pairs].p = q_factors.p[j];
+            pairs[num_pairs].k = q_factors.exp[j];
+            pairs[num_pairs].lambda = 0;
+            num_pairs++;
+        }
+    }
 
-                /* if h not found then n is composite */
-                if (h < 0)
-                    result = COMPOSITE;
+    /*
+        The checks for different pairs are independent, so they are shared
+        out between the threads; the first one to find n composite stops
+        the others.
+    */
+    if (result == PROBABPRIME)
+    {
+        qsort(pairs, num_pairs, sizeof(_jacobi_pair_struct), _jacobi_pair_cmp);
 
-                /* 
-                    check (Lp); 
-                    if h % p != 0 (primitive unity root) 
-                    then lambdas_p = 1
-                */
-                if (h % p != 0 && lambdas[pind] == 0)
-                    lambdas[pind] = 1;
-            }
+        arg.n = n;
+        arg.ndec = ndec;
+        arg.ndecdiv = ndecdiv;
+        arg.nmod4 = nmod4;
+        arg.pairs = pairs;
 
-            /* clear unity_zp for jacobi sums */
-            unity_zp_clear(jacobi_sum);
-            unity_zp_clear(jacobi_sum2_1);
-            unity_zp_clear(jacobi_sum2_2);
+        if (_aprcl_parallel_for(num_pairs, _is_prime_jacobi_pair, &arg))
+            result = COMPOSITE;
+        else
+        {
+            for (l = 0; l < num_pairs; l++)
+                if (pairs[l].lambda)
+                    lambdas[_p_ind(config, pairs[l].p)] = 1;
         }
-
     }
 
+    flint_free(pairs);
+
     /* Begin L_p tests */
 
     /* if n can be prime */
@@ -799,8 +875,6 @@ _is_prime_jacobi(const fmpz_t n, const aprcl_config config)
 
     /* clear */
     flint_free(lambdas);
-    fmpz_clear(u);
-    fmpz_clear(q_pow);
     fmpz_clear(p2);
     fmpz_clear(ndec);
     fmpz_clear(ndecdiv);
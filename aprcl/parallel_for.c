@@ -0,0 +1,104 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include "thread_pool.h"
+#include "aprcl.h"
+
+typedef struct
+{
+    pthread_mutex_t mutex;
+    slong next;
+    slong len;
+    int stop;
+    _aprcl_worker_fn fn;
+    void * arg;
+}
+_parallel_for_struct;
+
+/*
+    Each thread repeatedly takes the next unprocessed index. Once fn has
+    returned nonzero for some index no further indices are handed out.
+*/
+static void
+_aprcl_parallel_for_worker(void * varg)
+{
+    _parallel_for_struct * S = (_parallel_for_struct *) varg;
+    slong i;
+
+    while (1)
+    {
+        pthread_mutex_lock(&S->mutex);
+        if (S->stop || S->next >= S->len)
+        {
+            pthread_mutex_unlock(&S->mutex);
+            return;
+        }
+        i = S->next++;
+        pthread_mutex_unlock(&S->mutex);
+
+        if (S->fn(S->arg, i))
+        {
+            pthread_mutex_lock(&S->mutex);
+            S->stop = 1;
+            pthread_mutex_unlock(&S->mutex);
+            return;
+        }
+    }
+}
+
+int
+_aprcl_parallel_for(slong len, _aprcl_worker_fn fn, void * arg)
+{
+    slong i, num_workers;
+    thread_pool_handle * handles;
+    _parallel_for_struct S[1];
+
+    num_workers = 0;
+    handles = NULL;
+
+    if (!global_thread_pool_initialized || len < 2)
+    {
+        for (i = 0; i < len; i++)
+            if (fn(arg, i))
+                return 1;
+
+        return 0;
+    }
+
+    handles = (thread_pool_handle *) flint_malloc((len - 1)
+                                                 *sizeof(thread_pool_handle));
+    num_workers = thread_pool_request(global_thread_pool, handles, len - 1);
+
+    pthread_mutex_init(&S->mutex, NULL);
+    S->next = 0;
+    S->len = len;
+    S->stop = 0;
+    S->fn = fn;
+    S->arg = arg;
+
+    for (i = 0; i < num_workers; i++)
+        thread_pool_wake(global_thread_pool, handles[i],
+                                           _aprcl_parallel_for_worker, S);
+
+    _aprcl_parallel_for_worker(S);
+
+    for (i = 0; i < num_workers; i++)
+    {
+        thread_pool_wait(global_thread_pool, handles[i]);
+        thread_pool_give_back(global_thread_pool, handles[i]);
+    }
+
+    pthread_mutex_destroy(&S->mutex);
+    flint_free(handles);
+
+    return S->stop;
+}
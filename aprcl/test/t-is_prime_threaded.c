@@ -0,0 +1,116 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "aprcl.h"
+
+int main(void)
+{
+    int i, max_threads = 5;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("is_prime_threaded....");
+    fflush(stdout);
+
+    /* check the threaded final division against a single thread */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        int r1, r2;
+        ulong r;
+        fmpz_t n, s, p;
+
+        fmpz_init(n);
+        fmpz_init(s);
+        fmpz_init(p);
+
+        fmpz_randtest_unsigned(n, state, 100);
+        fmpz_add_ui(n, n, 2);
+        /* as in the APRCL test, n and s are coprime */
+        do {
+            fmpz_randtest_unsigned(s, state, n_randint(state, 20) + 2);
+            fmpz_add_ui(s, s, 2);
+            fmpz_gcd(p, n, s);
+        } while (!fmpz_is_one(p));
+        r = n_randint(state, 6000);
+
+        flint_set_num_threads(1);
+        r1 = is_prime_final_division(n, s, r);
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+        r2 = is_prime_final_division(n, s, r);
+
+        if (r1 != r2)
+        {
+            flint_printf("FAIL (final division)\n");
+            flint_printf("n = "); fmpz_print(n);
+            flint_printf("\ns = "); fmpz_print(s);
+            flint_printf("\nr = %wu, r1 = %d, r2 = %d\n", r, r1, r2);
+            abort();
+        }
+
+        fmpz_clear(n);
+        fmpz_clear(s);
+        fmpz_clear(p);
+    }
+
+    /* check the threaded tests against is_probabprime */
+    for (i = 0; i < 20 * flint_test_multiplier(); i++)
+    {
+        int pbprime, jacobiprime, gaussprime;
+        fmpz_t n, p;
+
+        fmpz_init(n);
+        fmpz_init(p);
+
+        flint_set_num_threads(n_randint(state, max_threads) + 1);
+
+        switch (n_randint(state, 3))
+        {
+            case 0:
+                fmpz_randtest_unsigned(n, state, 200);
+                break;
+            case 1:
+                fmpz_randprime(n, state, n_randint(state, 180) + 20, 0);
+                break;
+            default:
+                /* product of two primes of similar size */
+                fmpz_randprime(n, state, n_randint(state, 80) + 20, 0);
+                fmpz_randprime(p, state, fmpz_bits(n), 0);
+                fmpz_mul(n, n, p);
+        }
+
+        while (fmpz_cmp_ui(n, 100) <= 0)
+            fmpz_randtest_unsigned(n, state, 200);
+
+        pbprime = fmpz_is_probabprime(n);
+        jacobiprime = is_prime_jacobi(n);
+        gaussprime = (fmpz_bits(n) <= 50) ? is_prime_gauss(n) : pbprime;
+
+        if (pbprime != jacobiprime || pbprime != gaussprime)
+        {
+            flint_printf("FAIL\n");
+            flint_printf("n = "); fmpz_print(n);
+            flint_printf("\nis_probabprime = %d, is_prime_jacobi = %d, "
+                 "is_prime_gauss = %d\n", pbprime, jacobiprime, gaussprime);
+            abort();
+        }
+
+        fmpz_clear(n);
+        fmpz_clear(p);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
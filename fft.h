@@ -266,6 +266,13 @@ FLINT_DLL void fft_convolution(mp_limb_t ** ii, mp_limb_t ** jj, slong depth,
                                  slong limbs, slong trunc, mp_limb_t ** t1, 
                                 mp_limb_t ** t2, mp_limb_t ** s1, mp_limb_t ** tt);
 
+FLINT_DLL void fft_precache(mp_limb_t ** jj, slong depth, slong limbs,
+               slong trunc, mp_limb_t ** t1, mp_limb_t ** t2, mp_limb_t ** s1);
+
+FLINT_DLL void fft_convolution_precache(mp_limb_t ** ii, mp_limb_t ** jj,
+             slong depth, slong limbs, slong trunc, mp_limb_t ** t1,
+                           mp_limb_t ** t2, mp_limb_t ** s1, mp_limb_t ** tt);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,194 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "gmp.h"
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fft.h"
+
+/*
+   Row FFTs of the matrix fourier algorithm, as at the start of
+   fft_mfa_truncate_sqrt2_inner, followed by normalisation.
+*/
+static void
+_fft_mfa_precache_rows(mp_limb_t ** jj, mp_size_t n, mp_bitcnt_t w,
+     mp_limb_t ** t1, mp_limb_t ** t2, mp_size_t n1, mp_size_t trunc)
+{
+   mp_size_t i, j, s;
+   mp_size_t n2 = (2*n)/n1;
+   mp_size_t trunc2 = (trunc - 2*n)/n1;
+   mp_size_t limbs = (n*w)/FLINT_BITS;
+   mp_bitcnt_t depth = 0;
+   int k = 0;
+
+   while ((UWORD(1)<<depth) < n2) depth++;
+
+#pragma omp parallel for private(i, j, k)
+   for (i = 0; i < n2; i++)
+   {
+#if HAVE_OPENMP
+      k = omp_get_thread_num();
+#endif
+
+      fft_radix2(jj + i*n1, n1/2, w*n2, t1 + k, t2 + k);
+      for (j = 0; j < n1; j++)
+         mpn_normmod_2expp1(jj[i*n1 + j], limbs);
+   }
+
+   jj += 2*n;
+
+#pragma omp parallel for private(s, i, j, k)
+   for (s = 0; s < trunc2; s++)
+   {
+#if HAVE_OPENMP
+      k = omp_get_thread_num();
+#endif
+
+      i = n_revbin(s, depth);
+      fft_radix2(jj + i*n1, n1/2, w*n2, t1 + k, t2 + k);
+      for (j = 0; j < n1; j++)
+         mpn_normmod_2expp1(jj[i*n1 + j], limbs);
+   }
+}
+
+/*
+   As for fft_mfa_truncate_sqrt2_inner, except that the rows of jj
+   have already been transformed and normalised.
+*/
+static void
+_fft_mfa_truncate_sqrt2_inner_precache(mp_limb_t ** ii, mp_limb_t ** jj,
+     mp_size_t n, mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2,
+                           mp_size_t n1, mp_size_t trunc, mp_limb_t ** tt)
+{
+   mp_size_t i, j, s;
+   mp_size_t n2 = (2*n)/n1;
+   mp_size_t trunc2 = (trunc - 2*n)/n1;
+   mp_size_t limbs = (n*w)/FLINT_BITS;
+   mp_bitcnt_t depth = 0;
+   int k = 0;
+
+   while ((UWORD(1)<<depth) < n2) depth++;
+
+   ii += 2*n;
+   jj += 2*n;
+
+   /* convolutions on relevant rows */
+
+#pragma omp parallel for private(s, i, j, k)
+   for (s = 0; s < trunc2; s++)
+   {
+#if HAVE_OPENMP
+      k = omp_get_thread_num();
+#endif
+
+      i = n_revbin(s, depth);
+      fft_radix2(ii + i*n1, n1/2, w*n2, t1 + k, t2 + k);
+
+      for (j = 0; j < n1; j++)
+      {
+         mp_size_t t = i*n1 + j;
+         mpn_normmod_2expp1(ii[t], limbs);
+         fft_mulmod_2expp1(ii[t], ii[t], jj[t], n, w, tt[k]);
+      }
+
+      ifft_radix2(ii + i*n1, n1/2, w*n2, t1 + k, t2 + k);
+   }
+
+   ii -= 2*n;
+   jj -= 2*n;
+
+   /* convolutions on rows */
+
+#pragma omp parallel for private(i, j, k)
+   for (i = 0; i < n2; i++)
+   {
+#if HAVE_OPENMP
+      k = omp_get_thread_num();
+#endif
+
+      fft_radix2(ii + i*n1, n1/2, w*n2, t1 + k, t2 + k);
+
+      for (j = 0; j < n1; j++)
+      {
+         mp_size_t t = i*n1 + j;
+         mpn_normmod_2expp1(ii[t], limbs);
+         fft_mulmod_2expp1(ii[t], ii[t], jj[t], n, w, tt[k]);
+      }
+
+      ifft_radix2(ii + i*n1, n1/2, w*n2, t1 + k, t2 + k);
+   }
+}
+
+void fft_precache(mp_limb_t ** jj, slong depth, slong limbs, slong trunc,
+                         mp_limb_t ** t1, mp_limb_t ** t2, mp_limb_t ** s1)
+{
+   slong n = (WORD(1)<<depth), j;
+   slong w = (limbs*FLINT_BITS)/n;
+   slong sqrt = (WORD(1)<<(depth/2));
+
+   if (depth <= 6)
+   {
+      trunc = 2*((trunc + 1)/2);
+
+      fft_truncate_sqrt2(jj, n, w, t1, t2, s1, trunc);
+
+      for (j = 0; j < trunc; j++)
+         mpn_normmod_2expp1(jj[j], limbs);
+   } else
+   {
+      trunc = 2*sqrt*((trunc + 2*sqrt - 1)/(2*sqrt));
+
+      fft_mfa_truncate_sqrt2_outer(jj, n, w, t1, t2, s1, sqrt, trunc);
+
+      _fft_mfa_precache_rows(jj, n, w, t1, t2, sqrt, trunc);
+   }
+}
+
+void fft_convolution_precache(mp_limb_t ** ii, mp_limb_t ** jj, slong depth,
+                              slong limbs, slong trunc, mp_limb_t ** t1,
+                          mp_limb_t ** t2, mp_limb_t ** s1, mp_limb_t ** tt)
+{
+   slong n = (WORD(1)<<depth), j;
+   slong w = (limbs*FLINT_BITS)/n;
+   slong sqrt = (WORD(1)<<(depth/2));
+
+   if (depth <= 6)
+   {
+      trunc = 2*((trunc + 1)/2);
+
+      fft_truncate_sqrt2(ii, n, w, t1, t2, s1, trunc);
+
+      for (j = 0; j < trunc; j++)
+      {
+         mpn_normmod_2expp1(ii[j], limbs);
+
+         fft_mulmod_2expp1(ii[j], ii[j], jj[j], n, w, *tt);
+      }
+
+      ifft_truncate_sqrt2(ii, n, w, t1, t2, s1, trunc);
+
+      for (j = 0; j < trunc; j++)
+      {
+         mpn_div_2expmod_2expp1(ii[j], ii[j], limbs, depth + 2);
+         mpn_normmod_2expp1(ii[j], limbs);
+      }
+   } else
+   {
+      trunc = 2*sqrt*((trunc + 2*sqrt - 1)/(2*sqrt));
+
+      fft_mfa_truncate_sqrt2_outer(ii, n, w, t1, t2, s1, sqrt, trunc);
+
+      _fft_mfa_truncate_sqrt2_inner_precache(ii, jj, n, w, t1, t2,
+                                                         sqrt, trunc, tt);
+
+      ifft_mfa_truncate_sqrt2_outer(ii, n, w, t1, t2, s1, sqrt, trunc);
+   }
+}
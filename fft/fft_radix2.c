@@ -27,10 +27,16 @@ void fft_butterfly(mp_limb_t * s, mp_limb_t * t, mp_limb_t * i1,
    mpn_mul_2expmod_2expp1(t, t, limbs, b1);
 }
 
+/*
+   Two layers of butterflies are applied to each group of four coefficients
+   ii[i], ii[n/2 + i], ii[n + i], ii[3n/2 + i] while they are in cache, so
+   each pass over the data does the work of two radix 2 layers. The result
+   is the same as applying the layers one at a time.
+*/
 void fft_radix2(mp_limb_t ** ii, 
       mp_size_t n, mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2)
 {
-   mp_size_t i;
+   mp_size_t i, h = n/2;
    mp_size_t limbs = (w*n)/GMP_LIMB_BITS;
    
    if (n == 1) 
@@ -43,14 +49,30 @@ void fft_radix2(mp_limb_t ** ii,
       return;
    }
 
-   for (i = 0; i < n; i++) 
+   for (i = 0; i < h; i++) 
    {   
       fft_butterfly(*t1, *t2, ii[i], ii[n+i], i, limbs, w);
-   
       SWAP_PTRS(ii[i],   *t1);
       SWAP_PTRS(ii[n+i], *t2);
+
+      fft_butterfly(*t1, *t2, ii[h+i], ii[n+h+i], h+i, limbs, w);
+      SWAP_PTRS(ii[h+i],   *t1);
+      SWAP_PTRS(ii[n+h+i], *t2);
+
+      fft_butterfly(*t1, *t2, ii[i], ii[h+i], i, limbs, 2*w);
+      SWAP_PTRS(ii[i],   *t1);
+      SWAP_PTRS(ii[h+i], *t2);
+
+      fft_butterfly(*t1, *t2, ii[n+i], ii[n+h+i], i, limbs, 2*w);
+      SWAP_PTRS(ii[n+i],   *t1);
+      SWAP_PTRS(ii[n+h+i], *t2);
    }
 
-   fft_radix2(ii,     n/2, 2*w, t1, t2);
-   fft_radix2(ii + n, n/2, 2*w, t1, t2);
+   if (n > 2)
+   {
+      fft_radix2(ii,       n/4, 4*w, t1, t2);
+      fft_radix2(ii+h,     n/4, 4*w, t1, t2);
+      fft_radix2(ii+n,     n/4, 4*w, t1, t2);
+      fft_radix2(ii+n+h,   n/4, 4*w, t1, t2);
+   }
 }
@@ -27,10 +27,11 @@ void ifft_butterfly(mp_limb_t * s, mp_limb_t * t, mp_limb_t * i1,
    butterfly_rshB(s, t, i1, i2, limbs, 0, y);
 }
 
+/* as for fft_radix2, two layers are applied per pass over the data */
 void ifft_radix2(mp_limb_t ** ii, mp_size_t n, 
                  mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2)
 {
-   mp_size_t i;
+   mp_size_t i, h = n/2;
    mp_size_t limbs = (w*n)/FLINT_BITS;
     
    if (n == 1) 
@@ -43,14 +44,30 @@ void ifft_radix2(mp_limb_t ** ii, mp_size_t n,
       return;
    }
 
-   ifft_radix2(ii,   n/2, 2*w, t1, t2);
-   ifft_radix2(ii+n, n/2, 2*w, t1, t2);
+   if (n > 2)
+   {
+      ifft_radix2(ii,       n/4, 4*w, t1, t2);
+      ifft_radix2(ii+h,     n/4, 4*w, t1, t2);
+      ifft_radix2(ii+n,     n/4, 4*w, t1, t2);
+      ifft_radix2(ii+n+h,   n/4, 4*w, t1, t2);
+   }
 
-   for (i = 0; i < n; i++) 
+   for (i = 0; i < h; i++) 
    {   
+      ifft_butterfly(*t1, *t2, ii[i], ii[h+i], i, limbs, 2*w);
+      SWAP_PTRS(ii[i],   *t1);
+      SWAP_PTRS(ii[h+i], *t2);
+
+      ifft_butterfly(*t1, *t2, ii[n+i], ii[n+h+i], i, limbs, 2*w);
+      SWAP_PTRS(ii[n+i],   *t1);
+      SWAP_PTRS(ii[n+h+i], *t2);
+
       ifft_butterfly(*t1, *t2, ii[i], ii[n+i], i, limbs, w);
-   
       SWAP_PTRS(ii[i],   *t1);
       SWAP_PTRS(ii[n+i], *t2);
+
+      ifft_butterfly(*t1, *t2, ii[h+i], ii[n+h+i], h+i, limbs, w);
+      SWAP_PTRS(ii[h+i],   *t1);
+      SWAP_PTRS(ii[n+h+i], *t2);
    }
 }
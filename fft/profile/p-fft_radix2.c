@@ -0,0 +1,131 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fft.h"
+#include "profiler.h"
+
+/*
+   Compares fft_radix2 and ifft_radix2, which apply two layers of
+   butterflies per pass over the coefficients, with transforms applying
+   one layer per pass.
+*/
+
+static void fft_radix2_layer(mp_limb_t ** ii,
+      mp_size_t n, mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2)
+{
+   mp_size_t i;
+   mp_size_t limbs = (w*n)/GMP_LIMB_BITS;
+
+   for (i = 0; i < n; i++)
+   {
+      fft_butterfly(*t1, *t2, ii[i], ii[n+i], i, limbs, w);
+      SWAP_PTRS(ii[i],   *t1);
+      SWAP_PTRS(ii[n+i], *t2);
+   }
+
+   if (n > 1)
+   {
+      fft_radix2_layer(ii,   n/2, 2*w, t1, t2);
+      fft_radix2_layer(ii+n, n/2, 2*w, t1, t2);
+   }
+}
+
+static void ifft_radix2_layer(mp_limb_t ** ii,
+      mp_size_t n, mp_bitcnt_t w, mp_limb_t ** t1, mp_limb_t ** t2)
+{
+   mp_size_t i;
+   mp_size_t limbs = (w*n)/GMP_LIMB_BITS;
+
+   if (n > 1)
+   {
+      ifft_radix2_layer(ii,   n/2, 2*w, t1, t2);
+      ifft_radix2_layer(ii+n, n/2, 2*w, t1, t2);
+   }
+
+   for (i = 0; i < n; i++)
+   {
+      ifft_butterfly(*t1, *t2, ii[i], ii[n+i], i, limbs, w);
+      SWAP_PTRS(ii[i],   *t1);
+      SWAP_PTRS(ii[n+i], *t2);
+   }
+}
+
+int
+main(void)
+{
+    mp_bitcnt_t depth, w;
+
+    FLINT_TEST_INIT(state);
+
+    _flint_rand_init_gmp(state);
+
+    flint_printf("depth  w   limbs   layer (us)   fused (us)   ratio\n");
+
+    for (depth = 6; depth <= 13; depth++)
+    {
+        for (w = 1; w <= 2; w++)
+        {
+            mp_size_t n = (UWORD(1)<<depth), limbs = (n*w)/FLINT_BITS;
+            mp_size_t size = limbs + 1, j, iters;
+            mp_limb_t ** ii, * ptr, * t1, * t2;
+            timeit_t t0;
+            double t_layer, t_fused;
+
+            if (limbs == 0)
+                continue;
+
+            ii = flint_malloc((2*n + 2)*(sizeof(mp_limb_t *)
+                                              + size*sizeof(mp_limb_t)));
+            for (j = 0, ptr = (mp_limb_t *) (ii + 2*n + 2);
+                                           j < 2*n + 2; j++, ptr += size)
+                ii[j] = ptr;
+            t1 = ii[2*n];
+            t2 = ii[2*n + 1];
+
+            for (j = 0; j < 2*n; j++)
+                random_fermat(ii[j], state, limbs);
+
+            iters = FLINT_MAX(WORD(1), (WORD(1) << 26)/(n*size*depth));
+
+            timeit_start(t0);
+            for (j = 0; j < iters; j++)
+            {
+                fft_radix2_layer(ii, n, w, &t1, &t2);
+                ifft_radix2_layer(ii, n, w, &t1, &t2);
+            }
+            timeit_stop(t0);
+            t_layer = 1000.0*t0->cpu/iters;
+
+            timeit_start(t0);
+            for (j = 0; j < iters; j++)
+            {
+                fft_radix2(ii, n, w, &t1, &t2);
+                ifft_radix2(ii, n, w, &t1, &t2);
+            }
+            timeit_stop(t0);
+            t_fused = 1000.0*t0->cpu/iters;
+
+            flint_printf("%5wu %2wu %7wd %12.1f %12.1f %7.2f\n", depth, w,
+                            limbs, t_layer, t_fused, t_fused/t_layer);
+
+            flint_free(ii);
+        }
+    }
+
+    flint_randclear(state);
+
+    return 0;
+}
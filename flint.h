@@ -428,6 +428,7 @@ FLINT_DLL int flint_sscanf(const char * s, const char * str, ...); /* flint vers
 
 #include "gmpcompat.h"
 #include "exception.h"
+#include "tuning.h"
 
 #ifdef __cplusplus
 }
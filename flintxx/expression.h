@@ -28,6 +28,17 @@
 
 namespace flint {
 namespace detail {
+#if FLINTXX_HAVE_RVALUE_REFS
+// Determine if Data has a member function swap(Data&), which is used to
+// implement move assignment. See FLINTXX_DEFINE_DATA_MOVE.
+template<class Data, class Enable = void>
+struct has_data_swap : std::false_type { };
+template<class Data>
+struct has_data_swap<Data, decltype(std::declval<Data&>().swap(
+        std::declval<Data&>()))>
+    : std::true_type { };
+#endif
+
 // Helper traits used by the "expression" class, in particular the evaluate()
 // method. This is the general (i.e. non-immediate) case,
 // which requires actual work.
@@ -172,7 +183,8 @@ private:
         typename mp::enable_if<
             mp::equal_types<typename T::evaluated_t, derived_t> >::type* = 0)
     {
-        return data_t(t.evaluate()._data());
+        // the evaluated temporary is about to die, so take over its data
+        return data_t(FLINTXX_MOVE(t.evaluate()._data()));
     }
 
     // Invoke the data copy constructor when appropriate
@@ -227,6 +239,28 @@ public:
         return *this;
     }
 
+#if FLINTXX_HAVE_RVALUE_REFS
+    expression(const expression& o) : data(o.data) {}
+
+    expression(expression&& o)
+        noexcept(std::is_nothrow_move_constructible<Data>::value)
+        : data(std::move(o.data)) {}
+
+    // Swap the data if it supports this (i.e. if it owns its C object),
+    // otherwise (e.g. for references) assign as usual.
+    expression& operator=(expression&& o)
+    {
+        move_assign(o, detail::has_data_swap<Data>());
+        return *this;
+    }
+
+private:
+    void move_assign(expression& o, std::true_type) {data.swap(o.data);}
+    void move_assign(expression& o, std::false_type) {this->set(o.downcast());}
+
+public:
+#endif
+
     // See rules::instantiate_temporaries for explanation.
     evaluated_t create_temporary() const
     {
@@ -270,7 +304,11 @@ public:
         return rules::read<derived_t>::doit(f, downcast());
     }
 
+#if FLINTXX_HAVE_RVALUE_REFS
+    typename traits::make_const_ref<evaluation_return_t>::type evaluate() const
+#else
     typename traits::make_const<evaluation_return_t>::type evaluate() const
+#endif
     {
         return ev_traits_t::evaluate(downcast());
     }
@@ -358,6 +358,18 @@ protected:                                                                    \
     template<class D, class O, class Da>                                      \
     friend class expression;
 
+// Define a move constructor and a swap member function for the data struct
+// name, if the compiler supports rvalue references. Here initcode should
+// initialise inner cheaply and swapcode should swap inner with o.inner. The
+// swap member is what enables move assignment in the expression class.
+#if FLINTXX_HAVE_RVALUE_REFS
+#define FLINTXX_DEFINE_DATA_MOVE(name, initcode, swapcode)                    \
+    name(name&& o) noexcept {initcode; swapcode;}                             \
+    void swap(name& o) noexcept {swapcode;}
+#else
+#define FLINTXX_DEFINE_DATA_MOVE(name, initcode, swapcode)
+#endif
+
 // all flint classes should have this
 #define FLINTXX_DEFINE_BASICS(name)                                           \
 public:                                                                       \
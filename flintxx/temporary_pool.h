@@ -0,0 +1,132 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef CXX_TEMPORARY_POOL_H
+#define CXX_TEMPORARY_POOL_H
+
+#include "../flint.h"
+
+// This file contains a small per-thread pool of initialised C structs, used
+// by data classes whose init/clear pair involves heap allocation (e.g.
+// polynomials). Evaluating a compound expression such as a*b + c*d default
+// constructs its temporaries and destroys them at the end; with the pool,
+// the storage released by one evaluation is picked up by the next one.
+//
+// The pool is only used if thread local storage is available. Define
+// FLINTXX_USE_TEMPORARY_POOL to 0 to disable it.
+
+#ifndef FLINTXX_USE_TEMPORARY_POOL
+#if HAVE_TLS
+#define FLINTXX_USE_TEMPORARY_POOL 1
+#else
+#define FLINTXX_USE_TEMPORARY_POOL 0
+#endif
+#endif
+
+// number of structs kept per type and thread
+#ifndef FLINTXX_TEMPORARY_POOL_SIZE
+#define FLINTXX_TEMPORARY_POOL_SIZE 8
+#endif
+
+// structs with a larger capacity (as reported by Ops::capacity) are cleared
+// instead of being kept
+#ifndef FLINTXX_TEMPORARY_POOL_MAX_CAPACITY
+#define FLINTXX_TEMPORARY_POOL_MAX_CAPACITY 4096
+#endif
+
+namespace flint {
+namespace detail {
+// Ops must provide the static functions
+//   void init(Struct*), void clear(Struct*), void reset(Struct*),
+//   slong capacity(const Struct*),
+// where reset makes an initialised struct equal to a freshly initialised one
+// but may keep its allocation.
+template<class Struct, class Ops>
+class temporary_pool
+{
+private:
+    struct storage
+    {
+        Struct items[FLINTXX_TEMPORARY_POOL_SIZE];
+        int num;
+        int registered;
+    };
+
+#if FLINTXX_USE_TEMPORARY_POOL
+    static storage& local()
+    {
+        static FLINT_TLS_PREFIX storage s;
+        return s;
+    }
+
+    // registered with flint_cleanup, which runs per thread
+    static void cleanup()
+    {
+        storage& s = local();
+        for(int i = 0;i < s.num;++i)
+            Ops::clear(&s.items[i]);
+        s.num = 0;
+        s.registered = 0;
+    }
+#endif
+
+public:
+    // Initialise to, reusing the most recently released struct if possible.
+    static void acquire(Struct* to)
+    {
+#if FLINTXX_USE_TEMPORARY_POOL
+        storage& s = local();
+        if(s.num > 0)
+        {
+            *to = s.items[--s.num];
+            return;
+        }
+#endif
+        Ops::init(to);
+    }
+
+    // Give up from, which must be initialised. Structs without an allocation
+    // are not worth keeping, and neither are very large ones.
+    static void release(Struct* from)
+    {
+#if FLINTXX_USE_TEMPORARY_POOL
+        storage& s = local();
+        slong cap = Ops::capacity(from);
+        if(s.num < FLINTXX_TEMPORARY_POOL_SIZE && cap > 0
+                && cap <= FLINTXX_TEMPORARY_POOL_MAX_CAPACITY)
+        {
+            if(!s.registered)
+            {
+                flint_register_cleanup_function(&cleanup);
+                s.registered = 1;
+            }
+            Ops::reset(from);
+            s.items[s.num++] = *from;
+            return;
+        }
+#endif
+        Ops::clear(from);
+    }
+
+    // Number of structs currently held by the calling thread.
+    static int size()
+    {
+#if FLINTXX_USE_TEMPORARY_POOL
+        return local().num;
+#else
+        return 0;
+#endif
+    }
+};
+} // detail
+} // flint
+
+#endif
@@ -132,7 +132,57 @@ bool is_ternary(const T&)
 void
 test_extras()
 {
-    // TODO addmul when we have it
+    fmpz_polyxx a, b, c;
+    a = "3  1 2 3";
+    b = "2  -1 1";
+    c = "4  5 0 0 7";
+    tassert(is_ternary((a+a) - b*c));
+    tassert(is_ternary(b*c + (a+a)));
+    tassert(a + b*c == (b*c).evaluate() + a);
+    tassert((a+a) - b*c == fmpz_polyxx("5  7 -1 6 7 -7"));
+    tassert(b*c + (a+a) == fmpz_polyxx("5  -3 9 6 -7 7"));
+
+    fmpz_polyxx d(a);
+    tassert((d += b*c) == a + b*c);
+    tassert((d -= (b+b)*c) == a - b*c);
+    d -= d*d;
+    tassert(d == (a - b*c) - (a - b*c)*(a - b*c));
+
+    // the cancellation leaves a shorter polynomial
+    d = b*c;
+    d -= b*c;
+    tassert(d.is_zero() && d.length() == 0);
+}
+
+void
+test_temporary_pool()
+{
+    typedef detail::fmpz_poly_data::pool_t pool_t;
+    frandxx rand;
+    fmpz_polyxx a, b, c, d, r;
+
+    // temporaries are released after each evaluation and picked up by the
+    // next one; the results must not depend on what was there before
+    for(int i = 0;i < 50;++i)
+    {
+        a = fmpz_polyxx::randtest(rand, 1 + i % 20, 100);
+        b = fmpz_polyxx::randtest(rand, 1 + i % 13, 100);
+        c = fmpz_polyxx::randtest(rand, 1 + i % 7, 100);
+        d = fmpz_polyxx::randtest(rand, 1 + i % 3, 100);
+        r = a*b + c*d;
+        fmpz_polyxx s(a*b);
+        s += c*d;
+        tassert(r == s);
+        tassert((a + c)*(b + d) - r == a*d + c*b);
+    }
+
+#if FLINTXX_USE_TEMPORARY_POOL
+    tassert(pool_t::size() > 0);
+    tassert(pool_t::size() <= FLINTXX_TEMPORARY_POOL_SIZE);
+#endif
+
+    fmpz_polyxx e;
+    tassert(e.is_zero() && e.length() == 0);
 }
 
 ulong pow(ulong base, ulong exp)
@@ -320,13 +370,13 @@ test_functions()
     f *= 2;
     ulong d = 0;
     ltupleref(r, s, d) = pseudo_divrem(g, f);
-    tassert(r*f + s == g*pow(2, d));
+    tassert(r*f + s == g*pow(fmpzxx(2), d));
     r = 0; r = 0; d = 0;
     ltupleref(r, s, d) = pseudo_divrem_basecase(g, f);
-    tassert(r*f + s == g*pow(2, d));
+    tassert(r*f + s == g*pow(fmpzxx(2), d));
     r = 0; r = 0; d = 0;
     ltupleref(r, s, d) = pseudo_divrem_divconquer(g, f);
-    tassert(r*f + s == g*pow(2, d));
+    tassert(r*f + s == g*pow(fmpzxx(2), d));
 
     tassert(pseudo_div(g, f).get<0>() == r);
     tassert(pseudo_rem(g, f).get<0>() == s);
@@ -467,6 +517,7 @@ main()
     test_functions();
     test_member_functions();
     test_extras();
+    test_temporary_pool();
     test_factoring();
     test_hensel();
     test_printing();
@@ -573,6 +573,37 @@ test_crt()
     tassert(res == x);
 }
 
+void
+test_move()
+{
+#if FLINTXX_HAVE_RVALUE_REFS
+    fmpzxx a(fmpzxx(1) << 200);
+    fmpzxx b(a);
+    fmpz big = *b._data().inner;
+
+    // moving steals the representation and leaves a valid zero behind
+    fmpzxx c(std::move(b));
+    tassert(c == a && b.is_zero());
+    tassert(*c._data().inner == big);
+
+    b = fmpzxx(17);
+    c = std::move(b);
+    tassert(c == 17);
+    b = 5;
+    tassert(b == 5);
+
+    // expressions evaluate straight into the new object
+    fmpzxx d(a + c);
+    tassert(d - a == 17);
+
+    std::vector<fmpzxx> v;
+    for(int i = 0;i < 100;++i)
+        v.push_back(fmpzxx(fmpzxx(i) << 100));
+    for(int i = 0;i < 100;++i)
+        tassert(v[i] == fmpzxx(i) << 100);
+#endif
+}
+
 int
 main()
 {
@@ -593,6 +624,7 @@ main()
     test_randomisation();
     test_factoring();
     test_crt();
+    test_move();
     test_print_read(fmpzxx(-17));
 
     // TODO test that certain things *don't* compile?
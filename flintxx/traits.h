@@ -15,6 +15,25 @@
 // only for true_/false_
 #include "mp.h"
 
+// Rvalue references (and hence move construction and assignment) are used
+// when the compiler supports them. Define FLINTXX_HAVE_RVALUE_REFS to 0 to
+// get the C++98 behaviour.
+#ifndef FLINTXX_HAVE_RVALUE_REFS
+#if __cplusplus >= 201103L || (defined(_MSC_VER) && _MSC_VER >= 1900)
+#define FLINTXX_HAVE_RVALUE_REFS 1
+#else
+#define FLINTXX_HAVE_RVALUE_REFS 0
+#endif
+#endif
+
+#if FLINTXX_HAVE_RVALUE_REFS
+#include <utility>
+#include <type_traits>
+#define FLINTXX_MOVE(x) std::move(x)
+#else
+#define FLINTXX_MOVE(x) (x)
+#endif
+
 namespace flint {
 namespace detail {
 template<class T>
@@ -100,6 +119,11 @@ template<class T> struct reference<const T&> {typedef const T& type;};
 template<class T> struct make_const {typedef const T type;};
 template<class T> struct make_const<T&> {typedef const T& type;};
 
+// Turn T& into const T&, but leave values alone. This is for return types,
+// where a const value cannot be moved from.
+template<class T> struct make_const_ref {typedef T type;};
+template<class T> struct make_const_ref<T&> {typedef const T& type;};
+
 // Strip const and reference type annotations. This does *not* strip pointers!
 template<class T> struct basetype {typedef T type;};
 template<class T> struct basetype<const T> {typedef T type;};
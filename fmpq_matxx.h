@@ -251,6 +251,8 @@ struct fmpq_mat_data
         fmpq_mat_init(inner, fmpq_mat_nrows(o.inner), fmpq_mat_ncols(o.inner));
         fmpq_mat_set(inner, o.inner);
     }
+    FLINTXX_DEFINE_DATA_MOVE(fmpq_mat_data, fmpq_mat_init(inner, 0, 0),
+            fmpq_mat_swap(inner, o.inner))
 
     fmpq_mat_data(fmpq_matxx_srcref o)
     {
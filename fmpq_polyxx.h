@@ -22,6 +22,7 @@
 
 #include "flintxx/expression.h"
 #include "flintxx/flint_classes.h"
+#include "flintxx/temporary_pool.h"
 #include "flintxx/traits.h"
 
 // TODO exhibit this as a specialisation of a generic poly<fmpzxx>
@@ -279,20 +280,31 @@ struct fmpq_poly_traits<fmpq_polyxx>
         {return coeff_srcref_t::make(fmpq_poly_denref(p._poly()));}
 };
 
+struct fmpq_poly_pool_ops
+{
+    static void init(fmpq_poly_struct* p) {fmpq_poly_init(p);}
+    static void clear(fmpq_poly_struct* p) {fmpq_poly_clear(p);}
+    static void reset(fmpq_poly_struct* p) {fmpq_poly_zero(p);}
+    static slong capacity(const fmpq_poly_struct* p) {return p->alloc;}
+};
+
 struct fmpq_poly_data
 {
     fmpq_poly_t inner;
     typedef fmpq_poly_t& data_ref_t;
     typedef const fmpq_poly_t& data_srcref_t;
+    typedef temporary_pool<fmpq_poly_struct, fmpq_poly_pool_ops> pool_t;
 
-    fmpq_poly_data() {fmpq_poly_init(inner);}
-    ~fmpq_poly_data() {fmpq_poly_clear(inner);}
+    fmpq_poly_data() {pool_t::acquire(inner);}
+    ~fmpq_poly_data() {pool_t::release(inner);}
 
     fmpq_poly_data(const fmpq_poly_data& o)
     {
         fmpq_poly_init(inner);
         fmpq_poly_set(inner, o.inner);
     }
+    FLINTXX_DEFINE_DATA_MOVE(fmpq_poly_data, fmpq_poly_init(inner),
+            fmpq_poly_swap(inner, o.inner))
 
     fmpq_poly_data(fmpq_polyxx_srcref r)
     {
@@ -240,6 +240,8 @@ struct fmpq_data
         fmpq_init(inner);
         fmpq_set(inner, o.inner);
     }
+    FLINTXX_DEFINE_DATA_MOVE(fmpq_data, fmpq_init(inner),
+            fmpq_swap(inner, o.inner))
 
     fmpq_data(fmpqxx_srcref r)
     {
@@ -419,6 +421,8 @@ struct fmpq_vector_data
         for(slong i = 0;i < size;++i)
             fmpq_set(array + i, o.array + i);
     }
+    FLINTXX_DEFINE_DATA_MOVE(fmpq_vector_data, size = 0; array = 0,
+            std::swap(size, o.size); std::swap(array, o.array))
 
     fmpqxx_ref at(slong i) {return fmpqxx_ref::make(array + i);}
     fmpqxx_srcref at(slong i) const {return fmpqxx_srcref::make(array + i);}
@@ -102,6 +102,12 @@ FLINT_DLL int fmpz_lll_d(fmpz_mat_t B, fmpz_mat_t U, const fmpz_lll_t fl);
 
 FLINT_DLL int fmpz_lll_d_heuristic(fmpz_mat_t B, fmpz_mat_t U, const fmpz_lll_t fl);
 
+FLINT_DLL int fmpz_lll_householder_d(fmpz_mat_t B, fmpz_mat_t U, const fmpz_lll_t fl);
+
+FLINT_DLL int fmpz_lll_householder_ld(fmpz_mat_t B, fmpz_mat_t U, const fmpz_lll_t fl);
+
+FLINT_DLL int fmpz_lll_householder_dd(fmpz_mat_t B, fmpz_mat_t U, const fmpz_lll_t fl);
+
 FLINT_DLL int fmpz_lll_check_babai_heuristic(int kappa, fmpz_mat_t B, fmpz_mat_t U, mpf_mat_t mu, mpf_mat_t r, mpf *s,
        mpf_mat_t appB, fmpz_gram_t A,
        int a, int zeros, int kappamax, int n, mpf_t tmp, mpf_t rtmp, mp_bitcnt_t prec, const fmpz_lll_t fl);
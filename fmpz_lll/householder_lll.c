@@ -0,0 +1,485 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_lll.h"
+
+/*
+    Householder variant of the L^2 algorithm, following Morel, Stehle and
+    Villard. Row k of the basis is approximated from scratch, the
+    reflections of rows 0, ..., k - 1 are applied to it and it is size
+    reduced; this is repeated until the size reduction leaves the row
+    alone or its norm stops decreasing, so that the approximation never
+    drifts from the exact basis.
+
+    The including file defines FUNC_HEAD, the floating point type HLLL_T
+    and the following operations on it:
+
+    HLLL_SET_D, HLLL_SET_SI, HLLL_SET_UI    conversions to HLLL_T
+    HLLL_GET_UI(a)      floor of 0 <= a < 2^FLINT_BITS as a ulong
+    HLLL_ADD, HLLL_SUB, HLLL_MUL, HLLL_DIV, HLLL_NEG, HLLL_ABS
+    HLLL_SQRT(a)        square root of a with 0 <= a < 2^64
+    HLLL_RINT(a)        an integer nearest to a
+    HLLL_PREC           the precision in bits
+    HLLL_LT(a, b)       whether a < b
+    HLLL_IS_FINITE(a)   whether a is neither infinite nor a NaN
+    HLLL_MAX_EXP        the largest power of two applied at once when
+                        rescaling, well inside the exponent range so that
+                        a few limbs can be scaled by it without overflow
+*/
+
+#if defined(FUNC_HEAD) && defined(HLLL_T)
+
+/* a 2^(FLINT_BITS*i), where pw[j] = 2^(FLINT_BITS*(j - P)) */
+static HLLL_T
+_hlll_mul_2exp(HLLL_T a, slong i, const HLLL_T * pw, slong P)
+{
+    while (i > P)
+    {
+        a = HLLL_MUL(a, pw[2 * P]);
+        i -= P;
+    }
+
+    while (i < -P)
+    {
+        a = HLLL_MUL(a, pw[0]);
+        i += P;
+    }
+
+    return HLLL_MUL(a, pw[P + i]);
+}
+
+/*
+    Sets x to the approximation of the integer vector v scaled by
+    2^(-FLINT_BITS*e), where e is the largest number of limbs of an entry,
+    and returns e.
+*/
+static slong
+_hlll_get_vec(HLLL_T * x, const fmpz * v, slong n, const HLLL_T * pw,
+                                                    slong P, HLLL_T two_B)
+{
+    slong i, j, s, t, e;
+    HLLL_T y;
+
+    e = 0;
+    for (j = 0; j < n; j++)
+        e = FLINT_MAX(e, fmpz_size(v + j));
+
+    for (j = 0; j < n; j++)
+    {
+        if (!COEFF_IS_MPZ(v[j]))
+        {
+            x[j] = _hlll_mul_2exp(HLLL_SET_SI(v[j]), -e, pw, P);
+        }
+        else
+        {
+            __mpz_struct * z = COEFF_TO_PTR(v[j]);
+
+            s = FLINT_ABS(z->_mp_size);
+
+            /* the top three limbs are more than enough for any type */
+            t = FLINT_MIN(s, 3);
+            y = HLLL_SET_UI(z->_mp_d[s - 1]);
+            for (i = 2; i <= t; i++)
+                y = HLLL_ADD(HLLL_MUL(y, two_B), HLLL_SET_UI(z->_mp_d[s - i]));
+
+            y = _hlll_mul_2exp(y, s - t - e, pw, P);
+            x[j] = (z->_mp_size < 0) ? HLLL_NEG(y) : y;
+        }
+    }
+
+    return e;
+}
+
+/* sets z to the integer a, one limb at a time from the top */
+static void
+_hlll_get_fmpz(fmpz_t z, HLLL_T a, HLLL_T two_B, HLLL_T inv_two_B)
+{
+    int neg = HLLL_LT(a, HLLL_SET_D(0.0));
+    slong e = 0;
+    ulong u;
+
+    if (neg)
+        a = HLLL_NEG(a);
+
+    while (!HLLL_LT(a, two_B))
+    {
+        a = HLLL_MUL(a, inv_two_B);
+        e++;
+    }
+
+    u = HLLL_GET_UI(a);
+    fmpz_set_ui(z, u);
+
+    for ( ; e > 0; e--)
+    {
+        a = HLLL_MUL(HLLL_SUB(a, HLLL_SET_UI(u)), two_B);
+        u = HLLL_GET_UI(a);
+        fmpz_mul_2exp(z, z, FLINT_BITS);
+        fmpz_add_ui(z, z, u);
+    }
+
+    if (neg)
+        fmpz_neg(z, z);
+}
+
+/* dot product, with four independent sums to keep the pipelines full */
+static HLLL_T
+_hlll_dot(const HLLL_T * a, const HLLL_T * b, slong len)
+{
+    HLLL_T s0, s1, s2, s3;
+    slong j;
+
+    s0 = s1 = s2 = s3 = HLLL_SET_D(0.0);
+
+    for (j = 0; j + 4 <= len; j += 4)
+    {
+        s0 = HLLL_ADD(s0, HLLL_MUL(a[j + 0], b[j + 0]));
+        s1 = HLLL_ADD(s1, HLLL_MUL(a[j + 1], b[j + 1]));
+        s2 = HLLL_ADD(s2, HLLL_MUL(a[j + 2], b[j + 2]));
+        s3 = HLLL_ADD(s3, HLLL_MUL(a[j + 3], b[j + 3]));
+    }
+
+    for ( ; j < len; j++)
+        s0 = HLLL_ADD(s0, HLLL_MUL(a[j], b[j]));
+
+    return HLLL_ADD(HLLL_ADD(s0, s1), HLLL_ADD(s2, s3));
+}
+
+/*
+    Sets res to the norm of x, computed from scaled entries to avoid
+    overflow. Returns 0 if the norm is not finite.
+*/
+static int
+_hlll_norm(HLLL_T * res, const HLLL_T * x, slong len)
+{
+    HLLL_T M, s, t;
+    slong j;
+
+    M = HLLL_SET_D(0.0);
+    for (j = 0; j < len; j++)
+        if (HLLL_LT(M, HLLL_ABS(x[j])))
+            M = HLLL_ABS(x[j]);
+
+    if (!HLLL_IS_FINITE(M))
+        return 0;
+
+    if (!HLLL_LT(HLLL_SET_D(0.0), M))
+    {
+        *res = M;
+        return 1;
+    }
+
+    t = HLLL_SET_D(0.0);
+    for (j = 0; j < len; j++)
+    {
+        s = HLLL_DIV(x[j], M);
+        t = HLLL_ADD(t, HLLL_MUL(s, s));
+    }
+
+    *res = HLLL_MUL(M, HLLL_SQRT(t));
+
+    return 1;
+}
+
+/* x = x - c*y */
+static void
+_hlll_submul(HLLL_T * x, const HLLL_T * y, HLLL_T c, slong len)
+{
+    slong j;
+
+    for (j = 0; j < len; j++)
+        x[j] = HLLL_SUB(x[j], HLLL_MUL(c, y[j]));
+}
+
+/* swap rows k - 1 and k of B and U */
+static void
+_hlll_swap_rows(fmpz_mat_t B, fmpz_mat_t U, slong k)
+{
+    fmpz * t = B->rows[k];
+    B->rows[k] = B->rows[k - 1];
+    B->rows[k - 1] = t;
+
+    if (U != NULL)
+        _fmpz_vec_swap(U->rows[k], U->rows[k - 1], U->c);
+}
+
+FUNC_HEAD
+{
+    slong d, n, i, j, k, P, e, sh, swap_k, swap_e;
+    slong * expo;
+    HLLL_T * R, * V, * x, * pw;
+    HLLL_T zero, one, two_B, inv_two_B, eta, theta, delta, shrink;
+    HLLL_T m, y, X, s, t, nrm, prev_nrm, swap_r;
+    fmpz_t c;
+    double max_iter;
+    ulong iter;
+    int res = -1;
+
+    if (fl->rt != Z_BASIS)
+        return -1;
+
+    d = B->r;
+    n = B->c;
+
+    if (U != NULL && U->r != d)
+    {
+        flint_printf
+            ("Exception (fmpz_lll_householder*). Incompatible dimensions of capturing matrix.\n");
+        flint_abort();
+    }
+
+    if (d <= 1)
+        return 0;
+
+    zero = HLLL_SET_D(0.0);
+    one = HLLL_SET_D(1.0);
+    two_B = HLLL_SET_D(ldexp(1.0, FLINT_BITS));
+    inv_two_B = HLLL_SET_D(ldexp(1.0, -FLINT_BITS));
+    eta = HLLL_SET_D((fl->eta + 0.5) / 2);
+    theta = HLLL_SET_D(ldexp(1.0, -HLLL_PREC / 2));
+    delta = HLLL_SET_D((fl->delta + 1) / 2);
+    shrink = HLLL_SET_D(0.3);
+    prev_nrm = swap_r = zero;
+
+    /*
+        Row k of R is stored scaled by 2^(-FLINT_BITS*expo[k]), so that
+        there is no bound on the size of the entries. The reflections do
+        not depend on the scaling.
+    */
+    P = HLLL_MAX_EXP / FLINT_BITS;
+
+    pw = (HLLL_T *) flint_malloc((2 * P + 1) * sizeof(HLLL_T));
+    R = (HLLL_T *) flint_malloc(d * n * sizeof(HLLL_T));
+    V = (HLLL_T *) flint_malloc(d * n * sizeof(HLLL_T));
+    x = (HLLL_T *) flint_malloc(n * sizeof(HLLL_T));
+    expo = (slong *) flint_malloc(d * sizeof(slong));
+    fmpz_init(c);
+
+    pw[P] = one;
+    for (i = P - 1; i >= 0; i--)
+        pw[i] = HLLL_MUL(pw[i + 1], inv_two_B);
+    for (i = P + 1; i <= 2 * P; i++)
+        pw[i] = HLLL_MUL(pw[i - 1], two_B);
+
+    max_iter = (d - 1) + (d - 1) * d * (2.0 * FLINT_ABS(fmpz_mat_max_bits(B))
+                                  + d_log2(d)) / d_log2(8 / (fl->delta + 7));
+
+    k = 0;
+    iter = 0;
+    swap_k = -1;
+    swap_e = 0;
+
+    while (k < d)
+    {
+        HLLL_T * Rk = R + k * n, * Vk = V + k * n;
+        slong prev_e = 0;
+        int first = 1;
+
+        if (iter++ >= max_iter)
+            goto cleanup;
+
+        /*
+            Size reduce b_k until it is left unchanged or its norm stops
+            decreasing. In the latter case the remaining r_kj are rounding
+            errors relative to |b_k|, which the Lovasz test then deals with.
+        */
+        while (1)
+        {
+            int reduced = 0, stalled;
+
+            e = _hlll_get_vec(x, B->rows[k], n, pw, P, two_B);
+            if (!_hlll_norm(&nrm, x, n))
+                goto cleanup;
+
+            /* |b_k| = nrm 2^(FLINT_BITS*e) */
+            stalled = !first && e >= prev_e - P && !HLLL_LT(
+                _hlll_mul_2exp(nrm, e - prev_e, pw, P),
+                HLLL_MUL(shrink, prev_nrm));
+
+            for (i = 0; i < k; i++)
+            {
+                t = _hlll_dot(V + i * n + i, x + i, n - i);
+                _hlll_submul(x + i, V + i * n + i, t, n - i);
+            }
+
+            /* r_kk, which the size reduction does not change */
+            if (!_hlll_norm(&s, x + k, n - k))
+                goto cleanup;
+
+            if (stalled)
+                break;
+
+            for (j = k - 1; j >= 0; j--)
+            {
+                HLLL_T Rjj = HLLL_ABS(R[j * n + j]);
+
+                m = HLLL_DIV(x[j], R[j * n + j]);
+
+                if (!HLLL_IS_FINITE(m))
+                    goto cleanup;
+
+                /*
+                    mu_kj = m 2^(FLINT_BITS*sh). Reduce unless
+                    |mu_kj| <= eta + theta r_kk/r_jj, where the slack absorbs
+                    the rounding errors in r_kj, which are relative to |b_k|,
+                    once b_k is almost orthogonal to b_0, ..., b_{k-1}.
+                */
+                sh = e - expo[j];
+                t = HLLL_DIV(HLLL_MUL(theta, s), Rjj);
+
+                if (sh > 0)
+                {
+                    if (!HLLL_LT(HLLL_ADD(_hlll_mul_2exp(eta, -sh, pw, P), t),
+                                                                HLLL_ABS(m)))
+                        continue;
+
+                    /* mu_kj may be out of range, so only its top bits are
+                       removed, taking c = X 2^(FLINT_BITS*(sh - i)) */
+                    y = m;
+                    for (i = 0; i < sh && HLLL_LT(HLLL_ABS(y), two_B); i++)
+                        y = HLLL_MUL(y, two_B);
+                }
+                else
+                {
+                    y = _hlll_mul_2exp(m, sh, pw, P);
+                    if (!HLLL_LT(HLLL_ADD(eta, _hlll_mul_2exp(t, sh, pw, P)),
+                                                                HLLL_ABS(y)))
+                        continue;
+
+                    i = sh;
+                }
+
+                X = HLLL_RINT(y);
+                _hlll_get_fmpz(c, X, two_B, inv_two_B);
+                fmpz_mul_2exp(c, c, FLINT_BITS * (sh - i));
+
+                /* x = x - c r_j scaled by 2^(-FLINT_BITS*e) */
+                _hlll_submul(x, R + j * n, _hlll_mul_2exp(X, -i, pw, P), j + 1);
+
+                _fmpz_vec_scalar_submul_fmpz(B->rows[k], B->rows[j], n, c);
+                if (U != NULL)
+                    _fmpz_vec_scalar_submul_fmpz(U->rows[k], U->rows[j],
+                                                                   U->c, c);
+
+                reduced = 1;
+            }
+
+            if (!reduced)
+                break;
+
+            prev_nrm = nrm;
+            prev_e = e;
+            first = 0;
+        }
+
+        expo[k] = e;
+
+        /* a swap at k + 1 decreases r_kk unless the precision does
+           not suffice, in which case the swaps would cycle */
+        if (k == swap_k)
+        {
+            sh = e - swap_e;
+            if (sh > 0 ? !HLLL_LT(s, _hlll_mul_2exp(swap_r, -sh, pw, P))
+                       : !HLLL_LT(_hlll_mul_2exp(s, sh, pw, P), swap_r))
+                goto cleanup;
+
+            swap_k = -1;
+        }
+
+        /*
+            r_kk is lost in the rounding errors when b_k is much longer, so
+            the Lovasz condition fails. For k = 0 the first row is zero.
+        */
+        if (!HLLL_LT(zero, s))
+        {
+            if (k == 0)
+                goto cleanup;
+
+            swap_k = k - 1;
+            swap_e = expo[k - 1];
+            swap_r = HLLL_ABS(R[(k - 1) * n + k - 1]);
+            _hlll_swap_rows(B, U, k);
+            k--;
+            continue;
+        }
+
+        /* reflection taking x[k..n-1] to a multiple of the k-th unit vector,
+           where s = ||x[k..n-1]|| from the last pass */
+        for (j = 0; j < k; j++)
+            Rk[j] = x[j];
+
+        for (j = k; j < n; j++)
+            Vk[j] = HLLL_DIV(x[j], s);
+
+        /* ||V_k||^2 = 2 (1 + |x_k|/s), rescaled to 2 */
+        t = HLLL_SQRT(HLLL_DIV(one, HLLL_ADD(one, HLLL_ABS(Vk[k]))));
+        if (HLLL_LT(x[k], zero))
+        {
+            Rk[k] = s;
+            Vk[k] = HLLL_SUB(Vk[k], one);
+        }
+        else
+        {
+            Rk[k] = HLLL_NEG(s);
+            Vk[k] = HLLL_ADD(Vk[k], one);
+        }
+
+        for (j = k; j < n; j++)
+            Vk[j] = HLLL_MUL(Vk[j], t);
+
+        /* Lovasz condition delta r_{k-1,k-1}^2 <= r_{k,k}^2 + r_{k,k-1}^2,
+           divided by r_{k-1,k-1}^2 */
+        if (k > 0)
+        {
+            HLLL_T a = HLLL_DIV(Rk[k], R[(k - 1) * n + k - 1]);
+            HLLL_T b = HLLL_DIV(Rk[k - 1], R[(k - 1) * n + k - 1]);
+
+            sh = e - expo[k - 1];
+            if (sh > 0)
+            {
+                t = _hlll_mul_2exp(delta, -2 * sh, pw, P);
+            }
+            else
+            {
+                a = _hlll_mul_2exp(a, sh, pw, P);
+                b = _hlll_mul_2exp(b, sh, pw, P);
+                t = delta;
+            }
+
+            if (HLLL_LT(HLLL_ADD(HLLL_MUL(a, a), HLLL_MUL(b, b)), t))
+            {
+                swap_k = k - 1;
+                swap_e = expo[k - 1];
+                swap_r = HLLL_ABS(R[(k - 1) * n + k - 1]);
+                _hlll_swap_rows(B, U, k);
+                k--;
+                continue;
+            }
+        }
+
+        k++;
+    }
+
+    res = 0;
+
+cleanup:
+
+    fmpz_clear(c);
+    flint_free(expo);
+    flint_free(x);
+    flint_free(V);
+    flint_free(R);
+    flint_free(pw);
+
+    return res;
+}
+
+#endif
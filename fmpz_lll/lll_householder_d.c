@@ -0,0 +1,55 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <math.h>
+#include "fmpz_lll.h"
+
+#ifdef FUNC_HEAD
+#undef FUNC_HEAD
+#endif
+
+#define FUNC_HEAD int fmpz_lll_householder_d(fmpz_mat_t B, fmpz_mat_t U, const fmpz_lll_t fl)
+#define HLLL_T double
+#define HLLL_SET_D(a) ((double) (a))
+#define HLLL_SET_SI(a) ((double) (slong) (a))
+#define HLLL_SET_UI(a) ((double) (ulong) (a))
+#define HLLL_GET_UI(a) ((ulong) (a))
+#define HLLL_ADD(a, b) ((a) + (b))
+#define HLLL_SUB(a, b) ((a) - (b))
+#define HLLL_MUL(a, b) ((a) * (b))
+#define HLLL_DIV(a, b) ((a) / (b))
+#define HLLL_NEG(a) (-(a))
+#define HLLL_ABS(a) fabs(a)
+#define HLLL_SQRT(a) sqrt(a)
+#define HLLL_RINT(a) floor((a) + 0.5)
+#define HLLL_LT(a, b) ((a) < (b))
+#define HLLL_IS_FINITE(a) ((a) - (a) == 0.0)
+#define HLLL_MAX_EXP 900
+#define HLLL_PREC 53
+#include "householder_lll.c"
+#undef FUNC_HEAD
+#undef HLLL_T
+#undef HLLL_SET_D
+#undef HLLL_SET_SI
+#undef HLLL_SET_UI
+#undef HLLL_GET_UI
+#undef HLLL_ADD
+#undef HLLL_SUB
+#undef HLLL_MUL
+#undef HLLL_DIV
+#undef HLLL_NEG
+#undef HLLL_ABS
+#undef HLLL_SQRT
+#undef HLLL_RINT
+#undef HLLL_LT
+#undef HLLL_IS_FINITE
+#undef HLLL_MAX_EXP
+#undef HLLL_PREC
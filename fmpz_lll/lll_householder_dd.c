@@ -0,0 +1,231 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <math.h>
+#include "fmpz_lll.h"
+
+/*
+    Double-double arithmetic: a value is the unevaluated sum hi + lo of two
+    doubles with |lo| <= ulp(hi)/2, giving about 106 bits of precision.
+    The error free transformations are those of Dekker and Knuth.
+*/
+
+typedef struct
+{
+    double hi;
+    double lo;
+} _dd_t;
+
+static __inline__ _dd_t
+_dd_quick_two_sum(double a, double b)
+{
+    _dd_t r;
+    r.hi = a + b;
+    r.lo = b - (r.hi - a);
+    return r;
+}
+
+static __inline__ _dd_t
+_dd_two_sum(double a, double b)
+{
+    _dd_t r;
+    double bb;
+    r.hi = a + b;
+    bb = r.hi - a;
+    r.lo = (a - (r.hi - bb)) + (b - bb);
+    return r;
+}
+
+static __inline__ _dd_t
+_dd_two_prod(double a, double b)
+{
+    _dd_t r;
+    double t, ah, al, bh, bl;
+
+    t = 134217729.0 * a;    /* 2^27 + 1 */
+    ah = t - (t - a);
+    al = a - ah;
+    t = 134217729.0 * b;
+    bh = t - (t - b);
+    bl = b - bh;
+
+    r.hi = a * b;
+    r.lo = ((ah * bh - r.hi) + ah * bl + al * bh) + al * bl;
+    return r;
+}
+
+static __inline__ _dd_t
+_dd_set_d(double a)
+{
+    _dd_t r;
+    r.hi = a;
+    r.lo = 0.0;
+    return r;
+}
+
+static __inline__ _dd_t
+_dd_set_ui(ulong u)
+{
+    ulong h = u;
+    int b = FLINT_BIT_COUNT(u);
+
+    /* the top 53 bits and the rest are both exact doubles */
+    if (b > 53)
+        h &= ~((UWORD(1) << (b - 53)) - 1);
+
+    return _dd_quick_two_sum((double) h, (double) (u - h));
+}
+
+static __inline__ _dd_t
+_dd_neg(_dd_t a)
+{
+    a.hi = -a.hi;
+    a.lo = -a.lo;
+    return a;
+}
+
+static __inline__ _dd_t
+_dd_set_si(slong c)
+{
+    return c < 0 ? _dd_neg(_dd_set_ui(-(ulong) c)) : _dd_set_ui(c);
+}
+
+static __inline__ _dd_t
+_dd_add(_dd_t a, _dd_t b)
+{
+    _dd_t s = _dd_two_sum(a.hi, b.hi);
+    s.lo += a.lo + b.lo;
+    return _dd_quick_two_sum(s.hi, s.lo);
+}
+
+static __inline__ _dd_t
+_dd_sub(_dd_t a, _dd_t b)
+{
+    return _dd_add(a, _dd_neg(b));
+}
+
+static __inline__ _dd_t
+_dd_mul(_dd_t a, _dd_t b)
+{
+    _dd_t p = _dd_two_prod(a.hi, b.hi);
+    p.lo += a.hi * b.lo + a.lo * b.hi;
+    return _dd_quick_two_sum(p.hi, p.lo);
+}
+
+static __inline__ _dd_t
+_dd_div(_dd_t a, _dd_t b)
+{
+    double q1, q2;
+    _dd_t r;
+
+    q1 = a.hi / b.hi;
+    r = _dd_sub(a, _dd_mul(b, _dd_set_d(q1)));
+    q2 = r.hi / b.hi;
+    r = _dd_sub(r, _dd_mul(b, _dd_set_d(q2)));
+
+    return _dd_add(_dd_quick_two_sum(q1, q2), _dd_set_d(r.hi / b.hi));
+}
+
+static __inline__ _dd_t
+_dd_sqrt(_dd_t a)
+{
+    double x, y;
+
+    if (a.hi <= 0.0)
+        return _dd_set_d(0.0);
+
+    /* Karp's trick: one Newton step on the double square root */
+    x = sqrt(a.hi);
+    y = _dd_sub(a, _dd_two_prod(x, x)).hi / (2.0 * x);
+
+    return _dd_two_sum(x, y);
+}
+
+static __inline__ int
+_dd_lt(_dd_t a, _dd_t b)
+{
+    return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo);
+}
+
+static __inline__ _dd_t
+_dd_abs(_dd_t a)
+{
+    return a.hi < 0.0 ? _dd_neg(a) : a;
+}
+
+static __inline__ _dd_t
+_dd_rint(_dd_t a)
+{
+    double h = floor(a.hi + 0.5);
+
+    /* if hi is not an integer, |lo| is too small to matter */
+    if (h != a.hi)
+        return _dd_set_d(h);
+
+    return _dd_quick_two_sum(h, floor(a.lo + 0.5));
+}
+
+static __inline__ ulong
+_dd_get_ui(_dd_t a)
+{
+    double h = floor(a.hi);
+
+    if (h != a.hi)
+        return (ulong) h;
+
+    /* hi may be 2^FLINT_BITS with lo negative */
+    if (h >= ldexp(1.0, FLINT_BITS))
+        return (ulong) (slong) floor(a.lo);
+
+    return (ulong) h + (ulong) (slong) floor(a.lo);
+}
+
+#ifdef FUNC_HEAD
+#undef FUNC_HEAD
+#endif
+
+#define FUNC_HEAD int fmpz_lll_householder_dd(fmpz_mat_t B, fmpz_mat_t U, const fmpz_lll_t fl)
+#define HLLL_T _dd_t
+#define HLLL_SET_D(a) _dd_set_d(a)
+#define HLLL_SET_SI(a) _dd_set_si(a)
+#define HLLL_SET_UI(a) _dd_set_ui(a)
+#define HLLL_GET_UI(a) _dd_get_ui(a)
+#define HLLL_ADD(a, b) _dd_add(a, b)
+#define HLLL_SUB(a, b) _dd_sub(a, b)
+#define HLLL_MUL(a, b) _dd_mul(a, b)
+#define HLLL_DIV(a, b) _dd_div(a, b)
+#define HLLL_NEG(a) _dd_neg(a)
+#define HLLL_ABS(a) _dd_abs(a)
+#define HLLL_SQRT(a) _dd_sqrt(a)
+#define HLLL_RINT(a) _dd_rint(a)
+#define HLLL_LT(a, b) _dd_lt(a, b)
+#define HLLL_IS_FINITE(a) ((a).hi - (a).hi == 0.0)
+#define HLLL_MAX_EXP 900
+#define HLLL_PREC 106
+#include "householder_lll.c"
+#undef FUNC_HEAD
+#undef HLLL_T
+#undef HLLL_SET_D
+#undef HLLL_SET_SI
+#undef HLLL_SET_UI
+#undef HLLL_GET_UI
+#undef HLLL_ADD
+#undef HLLL_SUB
+#undef HLLL_MUL
+#undef HLLL_DIV
+#undef HLLL_NEG
+#undef HLLL_ABS
+#undef HLLL_SQRT
+#undef HLLL_RINT
+#undef HLLL_LT
+#undef HLLL_IS_FINITE
+#undef HLLL_MAX_EXP
+#undef HLLL_PREC
@@ -0,0 +1,87 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <float.h>
+#include <math.h>
+#include "fmpz_lll.h"
+
+/*
+    The long double functions of math.h are C99, so the few needed here
+    are done by hand.
+*/
+
+/* valid for 0 <= a < 2^64 */
+static __inline__ long double
+_ld_sqrt(long double a)
+{
+    long double y;
+
+    if (a == 0)
+        return a;
+
+    /* one Newton step doubles the precision of the double square root */
+    y = sqrt((double) a);
+    return (y + a / y) / 2;
+}
+
+static __inline__ long double
+_ld_rint(long double a)
+{
+    long double t = ldexp(1.0, FLINT_BITS - 1);
+
+    /* anything larger is an integer */
+    if (a >= t || a <= -t)
+        return a;
+
+    return (long double) (slong) (a < 0 ? a - 0.5L : a + 0.5L);
+}
+
+#ifdef FUNC_HEAD
+#undef FUNC_HEAD
+#endif
+
+#define FUNC_HEAD int fmpz_lll_householder_ld(fmpz_mat_t B, fmpz_mat_t U, const fmpz_lll_t fl)
+#define HLLL_T long double
+#define HLLL_SET_D(a) ((long double) (a))
+#define HLLL_SET_SI(a) ((long double) (slong) (a))
+#define HLLL_SET_UI(a) ((long double) (ulong) (a))
+#define HLLL_GET_UI(a) ((ulong) (a))
+#define HLLL_ADD(a, b) ((a) + (b))
+#define HLLL_SUB(a, b) ((a) - (b))
+#define HLLL_MUL(a, b) ((a) * (b))
+#define HLLL_DIV(a, b) ((a) / (b))
+#define HLLL_NEG(a) (-(a))
+#define HLLL_ABS(a) ((a) < 0 ? -(a) : (a))
+#define HLLL_SQRT(a) _ld_sqrt(a)
+#define HLLL_RINT(a) _ld_rint(a)
+#define HLLL_LT(a, b) ((a) < (b))
+#define HLLL_IS_FINITE(a) ((a) - (a) == 0)
+#define HLLL_MAX_EXP (LDBL_MAX_EXP / 2)
+#define HLLL_PREC LDBL_MANT_DIG
+#include "householder_lll.c"
+#undef FUNC_HEAD
+#undef HLLL_T
+#undef HLLL_SET_D
+#undef HLLL_SET_SI
+#undef HLLL_SET_UI
+#undef HLLL_GET_UI
+#undef HLLL_ADD
+#undef HLLL_SUB
+#undef HLLL_MUL
+#undef HLLL_DIV
+#undef HLLL_NEG
+#undef HLLL_ABS
+#undef HLLL_SQRT
+#undef HLLL_RINT
+#undef HLLL_LT
+#undef HLLL_IS_FINITE
+#undef HLLL_MAX_EXP
+#undef HLLL_PREC
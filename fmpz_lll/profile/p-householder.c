@@ -0,0 +1,115 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "profiler.h"
+#include "flint.h"
+#include "fmpz_lll.h"
+#include "fmpz.h"
+#include "ulong_extras.h"
+
+/*
+    Compares the Householder variants with the existing floating point
+    cascade on integer relation lattices, whose entries are large.
+*/
+
+typedef struct
+{
+    slong dim;
+    mp_bitcnt_t bits;
+    int algorithm;
+    int ok;
+} mat_lll_t;
+
+void
+sample(void *arg, ulong count)
+{
+    mat_lll_t *params = (mat_lll_t *) arg;
+    slong i, dim = params->dim;
+    int algorithm = params->algorithm, res = 0;
+    fmpz_lll_t fl;
+    fmpz_mat_t A, B;
+    FLINT_TEST_INIT(state);
+
+    fmpz_lll_context_init_default(fl);
+
+    fmpz_mat_init(A, dim, dim + 1);
+    fmpz_mat_randintrel(A, state, params->bits);
+    fmpz_mat_init(B, dim, dim + 1);
+
+    for (i = 0; i < count; i++)
+    {
+        fmpz_mat_set(B, A);
+
+        prof_start();
+
+        if (algorithm == 0)
+            res = fmpz_lll_d_heuristic(B, NULL, fl);
+        else if (algorithm == 1)
+            res = fmpz_lll_mpf(B, NULL, fl);
+        else if (algorithm == 2)
+            res = fmpz_lll_householder_d(B, NULL, fl);
+        else if (algorithm == 3)
+            res = fmpz_lll_householder_ld(B, NULL, fl);
+        else if (algorithm == 4)
+            res = fmpz_lll_householder_dd(B, NULL, fl);
+        else
+            res = fmpz_lll_wrapper(B, NULL, fl);
+
+        prof_stop();
+    }
+
+    params->ok = (res != -1) && fmpz_lll_is_reduced(B, fl, D_BITS);
+
+    fmpz_mat_clear(A);
+    fmpz_mat_clear(B);
+    flint_randclear(state);
+}
+
+int
+main(void)
+{
+    const char * names[6] = {"d_heuristic", "mpf", "householder_d",
+                             "householder_ld", "householder_dd", "wrapper"};
+    double min, max;
+    mat_lll_t params;
+    slong dim;
+    int alg;
+
+    flint_printf("fmpz_lll, integer relations, times in ms ('-' if the "
+                 "output is not reduced):\n");
+
+    for (dim = 10; dim <= 80; dim += 10)
+    {
+        for (params.bits = 500; params.bits <= 4000; params.bits *= 2)
+        {
+            params.dim = dim;
+
+            flint_printf("dim = %3wd bits = %4wu ", dim, params.bits);
+
+            for (alg = 0; alg < 6; alg++)
+            {
+                params.algorithm = alg;
+                prof_repeat(&min, &max, sample, &params);
+
+                if (params.ok)
+                    flint_printf(" %s %.1f", names[alg], min/1000);
+                else
+                    flint_printf(" %s -", names[alg]);
+            }
+
+            flint_printf("\n");
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,105 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_lll.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, res;
+    fmpz_mat_t mat, mat2, U;
+    fmpz_lll_t fl;
+    mp_bitcnt_t bits;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("lll_householder_ld....");
+    fflush(stdout);
+
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        slong r, c;
+        int ntru = n_randint(state, 2);
+
+        r = ntru ? 2 * (n_randint(state, 15) + 1) : n_randint(state, 30) + 1;
+        c = ntru ? r : r + 1;
+
+        fmpz_mat_init(mat, r, c);
+        fmpz_mat_init(mat2, r, c);
+        fmpz_mat_init(U, r, r);
+        fmpz_lll_randtest(fl, state);
+
+        bits = n_randint(state, 400) + 1;
+
+        if (ntru)
+            fmpz_mat_randntrulike(mat, state, bits, n_randint(state, 200) + 1);
+        else
+            fmpz_mat_randintrel(mat, state, bits);
+
+        fmpz_mat_set(mat2, mat);
+        fmpz_mat_one(U);
+
+        res = fmpz_lll_householder_ld(mat, U, fl);
+
+        if (fl->rt == GRAM)
+        {
+            if (res != -1)
+            {
+                flint_printf("FAIL (gram matrices are not supported)\n");
+                abort();
+            }
+        }
+        else
+        {
+            /* the multipliers are recorded even if the precision fails */
+            fmpz_mat_mul(mat2, U, mat2);
+            if (!fmpz_mat_equal(mat, mat2))
+            {
+                flint_printf("FAIL: basis matrices not equal!\n");
+                fmpz_mat_print_pretty(mat);
+                fmpz_mat_print_pretty(mat2);
+                abort();
+            }
+
+            if (res == -1 && r <= 20)
+            {
+                flint_printf("FAIL: precision did not suffice\n");
+                fmpz_mat_print_pretty(mat2);
+                flint_printf("bits = %wu, i = %d\n", bits, i);
+                abort();
+            }
+
+            if (res != -1 && !fmpz_mat_is_reduced(mat, fl->delta, fl->eta))
+            {
+                flint_printf("FAIL: not reduced\n");
+                fmpz_mat_print_pretty(mat);
+                flint_printf("bits = %wu, i = %d\n", bits, i);
+                flint_printf("delta = %g, eta = %g\n", fl->delta, fl->eta);
+                abort();
+            }
+        }
+
+        fmpz_mat_clear(mat);
+        fmpz_mat_clear(mat2);
+        fmpz_mat_clear(U);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -25,7 +25,17 @@ fmpz_lll_wrapper(fmpz_mat_t B, fmpz_mat_t U, const fmpz_lll_t fl)
             res = fmpz_lll_d_heuristic(B, U, fl);
             if ((res == -1) || (!fmpz_lll_is_reduced(B, fl, D_BITS)))
             {
-                res = fmpz_lll_mpf(B, U, fl);
+                /* Householder L^2 in extended precisions before mpf */
+                res = fmpz_lll_householder_ld(B, U, fl);
+                if ((res == -1) || (!fmpz_lll_is_reduced(B, fl, D_BITS)))
+                {
+                    res = fmpz_lll_householder_dd(B, U, fl);
+                    if ((res == -1)
+                        || (!fmpz_lll_is_reduced(B, fl, D_BITS)))
+                    {
+                        res = fmpz_lll_mpf(B, U, fl);
+                    }
+                }
             }
         }
         else
@@ -330,6 +330,8 @@ struct fmpz_mat_data
     {
         fmpz_mat_init_set(inner, o.inner);
     }
+    FLINTXX_DEFINE_DATA_MOVE(fmpz_mat_data, fmpz_mat_init(inner, 0, 0),
+            fmpz_mat_swap(inner, o.inner))
 
     fmpz_mat_data(fmpz_matxx_srcref o)
     {
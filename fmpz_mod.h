@@ -44,11 +44,18 @@
         if      n < 2^FLINT_BITS     -> add1, sub1, mul1 using nmod
         else if n = 2^FLINT_BITS     -> add2s, sub2s, mul2s
         else if n < 2^(2*FLINT_BITS) -> add2, sub2, mul2
+        else if n < 2^(FMPZ_MOD_MPN_MAX_LIMBS*FLINT_BITS)
+                                     -> add_mpn, sub_mpn, mul_mpn
         else                         -> addN, subN, mulN
 
-    A special case for the multiplication for 3-word shows no signs of
-    diminishing returns, but it is not implemented currently.
+    The mpn functions work on fixed size limb arrays on the stack. They use
+    the normalised modulus nnorm = n*2^norm and the precomputed inverse
+    dinv of its top limb for division, and minv = -1/n mod 2^FLINT_BITS for
+    Montgomery reduction when n is odd (minv = 0 otherwise).
 */
+
+#define FMPZ_MOD_MPN_MAX_LIMBS 16
+
 typedef struct fmpz_mod_ctx {
     fmpz_t n;
     void (* add_fxn)(fmpz_t, const fmpz_t, const fmpz_t, const struct fmpz_mod_ctx *);
@@ -57,6 +64,11 @@ typedef struct fmpz_mod_ctx {
     nmod_t mod;
     ulong n_limbs[3];
     ulong ninv_limbs[3];
+    mp_size_t nlimbs;   /* number of limbs of n in the mpn case, else 0 */
+    ulong norm;
+    mp_limb_t dinv;
+    mp_limb_t minv;
+    mp_limb_t nnorm[FMPZ_MOD_MPN_MAX_LIMBS];
 } fmpz_mod_ctx_struct;
 typedef fmpz_mod_ctx_struct fmpz_mod_ctx_t[1];
 
@@ -90,6 +102,9 @@ FLINT_DLL void _fmpz_mod_add2s(fmpz_t a, const fmpz_t b, const fmpz_t c,
 FLINT_DLL void _fmpz_mod_add2(fmpz_t a, const fmpz_t b, const fmpz_t c,
                                                      const fmpz_mod_ctx_t ctx);
 
+FLINT_DLL void _fmpz_mod_add_mpn(fmpz_t a, const fmpz_t b, const fmpz_t c,
+                                                     const fmpz_mod_ctx_t ctx);
+
 FLINT_DLL void _fmpz_mod_addN(fmpz_t a, const fmpz_t b, const fmpz_t c,
                                                      const fmpz_mod_ctx_t ctx);
 
@@ -108,6 +123,9 @@ FLINT_DLL void _fmpz_mod_sub2s(fmpz_t a, const fmpz_t b, const fmpz_t c,
 FLINT_DLL void _fmpz_mod_sub2(fmpz_t a, const fmpz_t b, const fmpz_t c,
                                                      const fmpz_mod_ctx_t ctx);
 
+FLINT_DLL void _fmpz_mod_sub_mpn(fmpz_t a, const fmpz_t b, const fmpz_t c,
+                                                     const fmpz_mod_ctx_t ctx);
+
 FLINT_DLL void _fmpz_mod_subN(fmpz_t a, const fmpz_t b, const fmpz_t c,
                                                      const fmpz_mod_ctx_t ctx);
 
@@ -130,6 +148,9 @@ FLINT_DLL void _fmpz_mod_mul2s(fmpz_t a, const fmpz_t b, const fmpz_t c,
 FLINT_DLL void _fmpz_mod_mul2(fmpz_t a, const fmpz_t b, const fmpz_t c,
                                                      const fmpz_mod_ctx_t ctx);
 
+FLINT_DLL void _fmpz_mod_mul_mpn(fmpz_t a, const fmpz_t b, const fmpz_t c,
+                                                     const fmpz_mod_ctx_t ctx);
+
 FLINT_DLL void _fmpz_mod_mulN(fmpz_t a, const fmpz_t b, const fmpz_t c,
                                                      const fmpz_mod_ctx_t ctx);
 
@@ -140,6 +161,34 @@ FMPZ_MOD_INLINE void fmpz_mod_mul(fmpz_t a, const fmpz_t b, const fmpz_t c,
 }
 
 
+/* fixed size limb arrays for the mpn case */
+
+FLINT_DLL void _fmpz_mod_mpn_reduce(mp_ptr r, mp_ptr t, mp_size_t tn,
+                                                     const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_mod_mpn_redc(mp_ptr r, mp_ptr t,
+                                                     const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_mod_mpn_mul(mp_ptr r, mp_srcptr b, mp_srcptr c,
+                                                     const fmpz_mod_ctx_t ctx);
+
+/* vectors of canonical residues */
+
+FLINT_DLL void _fmpz_mod_vec_add(fmpz * A, const fmpz * B, const fmpz * C,
+                                          slong len, const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_mod_vec_sub(fmpz * A, const fmpz * B, const fmpz * C,
+                                          slong len, const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_mod_vec_mul(fmpz * A, const fmpz * B, const fmpz * C,
+                                          slong len, const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_mod_vec_scalar_mul_fmpz_mod(fmpz * A, const fmpz * B,
+                          slong len, const fmpz_t c, const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_mod_vec_dot(fmpz_t d, const fmpz * A, const fmpz * B,
+                                          slong len, const fmpz_mod_ctx_t ctx);
+
 FLINT_DLL void fmpz_mod_inv(fmpz_t a, const fmpz_t b,
                                                      const fmpz_mod_ctx_t ctx);
 
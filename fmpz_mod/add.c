@@ -66,6 +66,28 @@ void _fmpz_mod_add2(fmpz_t a, const fmpz_t b, const fmpz_t c,
     FLINT_ASSERT(fmpz_mod_is_canonical(a, ctx));
 }
 
+void _fmpz_mod_add_mpn(fmpz_t a, const fmpz_t b, const fmpz_t c,
+                                                     const fmpz_mod_ctx_t ctx)
+{
+    mp_size_t k = ctx->nlimbs;
+    mp_srcptr n = COEFF_TO_PTR(*ctx->n)->_mp_d;
+    mp_limb_t s[FMPZ_MOD_MPN_MAX_LIMBS], t[FMPZ_MOD_MPN_MAX_LIMBS];
+
+    FLINT_ASSERT(fmpz_mod_is_canonical(b, ctx));
+    FLINT_ASSERT(fmpz_mod_is_canonical(c, ctx));
+
+    fmpz_get_ui_array(s, k, b);
+    fmpz_get_ui_array(t, k, c);
+
+    /* at most one subtraction of n */
+    if (mpn_add_n(s, s, t, k) || mpn_cmp(s, n, k) >= 0)
+        mpn_sub_n(s, s, n, k);
+
+    fmpz_set_ui_array(a, s, k);
+
+    FLINT_ASSERT(fmpz_mod_is_canonical(a, ctx));
+}
+
 void _fmpz_mod_addN(fmpz_t a, const fmpz_t b, const fmpz_t c,
                                                      const fmpz_mod_ctx_t ctx)
 {
@@ -29,6 +29,7 @@ void fmpz_mod_ctx_init(fmpz_mod_ctx_t ctx, const fmpz_t n)
     ctx->add_fxn = _fmpz_mod_addN;
     ctx->sub_fxn = _fmpz_mod_subN;
     ctx->mul_fxn = _fmpz_mod_mulN;
+    ctx->nlimbs = 0;
 
     bits = fmpz_bits(n);
     if (bits <= FLINT_BITS)
@@ -64,4 +65,34 @@ void fmpz_mod_ctx_init(fmpz_mod_ctx_t ctx, const fmpz_t n)
             ctx->mul_fxn = _fmpz_mod_mul2;
         }
     }
+    else if (bits <= FMPZ_MOD_MPN_MAX_LIMBS*FLINT_BITS)
+    {
+        mp_size_t k = fmpz_size(n);
+        mp_srcptr d = COEFF_TO_PTR(*n)->_mp_d;
+
+        ctx->nlimbs = k;
+        count_leading_zeros(ctx->norm, d[k - 1]);
+        if (ctx->norm)
+            mpn_lshift(ctx->nnorm, d, k, ctx->norm);
+        else
+            flint_mpn_copyi(ctx->nnorm, d, k);
+        ctx->dinv = n_preinvert_limb(ctx->nnorm[k - 1]);
+
+        /* Newton iteration for 1/n mod 2^FLINT_BITS, starting from 3 bits */
+        ctx->minv = 0;
+        if (d[0] & 1)
+        {
+            mp_limb_t x = d[0];
+            int i;
+
+            for (i = 0; i < 5; i++)
+                x *= 2 - d[0]*x;
+
+            ctx->minv = -x;
+        }
+
+        ctx->add_fxn = _fmpz_mod_add_mpn;
+        ctx->sub_fxn = _fmpz_mod_sub_mpn;
+        ctx->mul_fxn = _fmpz_mod_mul_mpn;
+    }
 }
@@ -144,6 +144,105 @@ void _fmpz_mod_mul2(fmpz_t a, const fmpz_t b, const fmpz_t c,
 
 }
 
+/*
+    Set r to t mod n, where t has tn >= nlimbs limbs and space for tn + 1.
+    The array t is destroyed. This is schoolbook division by the normalised
+    modulus with quotient digits estimated from the precomputed inverse of
+    its top limb. Each estimate is at most two too large and is corrected
+    by adding back the divisor.
+*/
+void _fmpz_mod_mpn_reduce(mp_ptr r, mp_ptr t, mp_size_t tn,
+                                                     const fmpz_mod_ctx_t ctx)
+{
+    mp_size_t i, k = ctx->nlimbs;
+    mp_srcptr d = ctx->nnorm;
+    mp_limb_t q, rem, dtop = d[k - 1];
+
+    FLINT_ASSERT(tn >= k);
+
+    t[tn] = ctx->norm ? mpn_lshift(t, t, tn, ctx->norm) : 0;
+
+    for (i = tn; i >= k; i--)
+    {
+        /* t[i - k + 1, i] < d, so the quotient digit fits in a limb */
+        if (t[i] == dtop)
+            q = ~UWORD(0);
+        else
+            udiv_qrnnd_preinv(q, rem, t[i], t[i - 1], dtop, ctx->dinv);
+
+        t[i] -= mpn_submul_1(t + i - k, d, k, q);
+
+        while (t[i] != 0)
+            t[i] += mpn_add_n(t + i - k, t + i - k, d, k);
+    }
+
+    if (ctx->norm)
+        mpn_rshift(r, t, k, ctx->norm);
+    else
+        flint_mpn_copyi(r, t, k);
+}
+
+/*
+    Montgomery reduction for odd n: set r to t/2^(FLINT_BITS*nlimbs) mod n,
+    where t has 2*nlimbs limbs and t < n*2^(FLINT_BITS*nlimbs). The array t
+    is destroyed.
+*/
+void _fmpz_mod_mpn_redc(mp_ptr r, mp_ptr t, const fmpz_mod_ctx_t ctx)
+{
+    mp_size_t i, k = ctx->nlimbs;
+    mp_srcptr n = COEFF_TO_PTR(*ctx->n)->_mp_d;
+
+    FLINT_ASSERT(ctx->minv != 0);
+
+    /* clear the low limbs, keeping the carries in the limbs freed up */
+    for (i = 0; i < k; i++)
+        t[i] = mpn_addmul_1(t + i, n, k, t[i]*ctx->minv);
+
+    /* the result is less than 2n */
+    if (mpn_add_n(r, t + k, t, k) || mpn_cmp(r, n, k) >= 0)
+        mpn_sub_n(r, r, n, k);
+}
+
+void _fmpz_mod_mpn_mul(mp_ptr r, mp_srcptr b, mp_srcptr c,
+                                                     const fmpz_mod_ctx_t ctx)
+{
+    mp_size_t k = ctx->nlimbs;
+    mp_limb_t t[2*FMPZ_MOD_MPN_MAX_LIMBS + 1];
+
+    if (b == c)
+        mpn_sqr(t, b, k);
+    else
+        mpn_mul_n(t, b, c, k);
+
+    _fmpz_mod_mpn_reduce(r, t, 2*k, ctx);
+}
+
+void _fmpz_mod_mul_mpn(fmpz_t a, const fmpz_t b, const fmpz_t c,
+                                                     const fmpz_mod_ctx_t ctx)
+{
+    mp_size_t k = ctx->nlimbs;
+    mp_limb_t s[FMPZ_MOD_MPN_MAX_LIMBS], t[FMPZ_MOD_MPN_MAX_LIMBS];
+
+    FLINT_ASSERT(fmpz_mod_is_canonical(b, ctx));
+    FLINT_ASSERT(fmpz_mod_is_canonical(c, ctx));
+
+    fmpz_get_ui_array(s, k, b);
+
+    if (b == c)
+    {
+        _fmpz_mod_mpn_mul(s, s, s, ctx);
+    }
+    else
+    {
+        fmpz_get_ui_array(t, k, c);
+        _fmpz_mod_mpn_mul(s, s, t, ctx);
+    }
+
+    fmpz_set_ui_array(a, s, k);
+
+    FLINT_ASSERT(fmpz_mod_is_canonical(a, ctx));
+}
+
 void _fmpz_mod_mulN(fmpz_t a, const fmpz_t b, const fmpz_t c,
                                                      const fmpz_mod_ctx_t ctx)
 {
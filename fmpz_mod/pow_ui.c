@@ -11,10 +11,52 @@
 
 #include "fmpz_mod.h"
 
+/*
+    Left to right binary powering in Montgomery form for odd multi-limb n.
+    The powers are kept in fixed size limb arrays, so there is no memory
+    management in the main loop.
+*/
+static void _fmpz_mod_pow_ui_mpn(fmpz_t a, const fmpz_t b, ulong e,
+                                                     const fmpz_mod_ctx_t ctx)
+{
+    mp_size_t k = ctx->nlimbs;
+    mp_limb_t x[FMPZ_MOD_MPN_MAX_LIMBS], y[FMPZ_MOD_MPN_MAX_LIMBS];
+    mp_limb_t t[2*FMPZ_MOD_MPN_MAX_LIMBS + 1];
+    int i;
+
+    /* x = b*2^(FLINT_BITS*k) mod n */
+    flint_mpn_zero(t, k);
+    fmpz_get_ui_array(t + k, k, b);
+    _fmpz_mod_mpn_reduce(x, t, 2*k, ctx);
+    flint_mpn_copyi(y, x, k);
+
+    for (i = FLINT_BIT_COUNT(e) - 2; i >= 0; i--)
+    {
+        mpn_sqr(t, y, k);
+        _fmpz_mod_mpn_redc(y, t, ctx);
+
+        if ((e >> i) & 1)
+        {
+            mpn_mul_n(t, y, x, k);
+            _fmpz_mod_mpn_redc(y, t, ctx);
+        }
+    }
+
+    /* convert back from Montgomery form */
+    flint_mpn_copyi(t, y, k);
+    flint_mpn_zero(t + k, k);
+    _fmpz_mod_mpn_redc(y, t, ctx);
+
+    fmpz_set_ui_array(a, y, k);
+}
+
 void fmpz_mod_pow_ui(fmpz_t a, const fmpz_t b, ulong pow,
                                                      const fmpz_mod_ctx_t ctx)
 {
     FLINT_ASSERT(fmpz_mod_is_canonical(b, ctx));
-    fmpz_powm_ui(a, b, pow, ctx->n);
+    if (ctx->nlimbs != 0 && ctx->minv != 0 && pow != 0)
+        _fmpz_mod_pow_ui_mpn(a, b, pow, ctx);
+    else
+        fmpz_powm_ui(a, b, pow, ctx->n);
     FLINT_ASSERT(fmpz_mod_is_canonical(a, ctx));
 }
@@ -38,7 +38,7 @@ main(void)
 
         for (j = 0; j < 10; j++)
         {
-            fmpz_randtest_unsigned(p, state, 300);
+            fmpz_randtest_unsigned(p, state, 1200);
             fmpz_add_ui(p, p, 1);
             fmpz_mod_ctx_set_modulus(fpctx, p);
 
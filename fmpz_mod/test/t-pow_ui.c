@@ -14,7 +14,7 @@
 int
 main(void)
 {
-    mp_bitcnt_t max_modulus_bits = 200;
+    mp_bitcnt_t max_modulus_bits = 1200;
     slong i, j;
     FLINT_TEST_INIT(state);
 
@@ -82,6 +82,17 @@ main(void)
                 flint_abort();
             }
 
+            /* check against fmpz_powm_ui */
+            fmpz_mod_pow_ui(u, b, e, fpctx);
+            fmpz_powm_ui(v, b, e, p);
+            if (!fmpz_equal(u, v))
+            {
+                printf("FAIL\n");
+                flint_printf("check against fmpz_powm_ui\n"
+                                            "i = %wd, j = %wd\n", i, j);
+                flint_abort();
+            }
+
             /* check 0^0 = 1 */
             fmpz_zero(a);
             fmpz_mod_pow_ui(u, a, 0, fpctx);
@@ -0,0 +1,133 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_mod.h"
+
+int
+main(void)
+{
+    slong i, j;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("vec....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        slong len = n_randint(state, 20);
+        fmpz_t p, c, d, e;
+        fmpz * A, * B, * C, * D;
+        fmpz_mod_ctx_t fpctx;
+
+        fmpz_init(p);
+        fmpz_init(c);
+        fmpz_init(d);
+        fmpz_init(e);
+
+        if (n_randint(state, 4) == 0)
+        {
+            /* one less than a power of 2 */
+            fmpz_one(p);
+            fmpz_mul_2exp(p, p, 1 + n_randint(state, 1200));
+            fmpz_sub_ui(p, p, 1);
+        }
+        else
+        {
+            fmpz_randtest_unsigned(p, state, 1200);
+            fmpz_add_ui(p, p, 1);
+        }
+
+        fmpz_mod_ctx_init(fpctx, p);
+
+        A = _fmpz_vec_init(len);
+        B = _fmpz_vec_init(len);
+        C = _fmpz_vec_init(len);
+        D = _fmpz_vec_init(len);
+
+        for (j = 0; j < len; j++)
+        {
+            fmpz_randtest_mod(B + j, state, p);
+            fmpz_randtest_mod(C + j, state, p);
+        }
+        fmpz_randtest_mod(c, state, p);
+
+        /* add */
+        _fmpz_mod_vec_add(A, B, C, len, fpctx);
+        _fmpz_vec_add(D, B, C, len);
+        _fmpz_vec_scalar_mod_fmpz(D, D, len, p);
+        if (!_fmpz_vec_equal(A, D, len))
+        {
+            flint_printf("FAIL\ncheck add\ni = %wd\n", i);
+            flint_abort();
+        }
+
+        /* sub with aliasing */
+        _fmpz_vec_set(A, B, len);
+        _fmpz_mod_vec_sub(A, A, C, len, fpctx);
+        _fmpz_vec_sub(D, B, C, len);
+        _fmpz_vec_scalar_mod_fmpz(D, D, len, p);
+        if (!_fmpz_vec_equal(A, D, len))
+        {
+            flint_printf("FAIL\ncheck sub\ni = %wd\n", i);
+            flint_abort();
+        }
+
+        /* mul */
+        _fmpz_mod_vec_mul(A, B, C, len, fpctx);
+        for (j = 0; j < len; j++)
+        {
+            fmpz_mul(D + j, B + j, C + j);
+            fmpz_mod(D + j, D + j, p);
+        }
+        if (!_fmpz_vec_equal(A, D, len))
+        {
+            flint_printf("FAIL\ncheck mul\ni = %wd\n", i);
+            flint_abort();
+        }
+
+        /* scalar mul with aliasing */
+        _fmpz_vec_set(A, B, len);
+        _fmpz_mod_vec_scalar_mul_fmpz_mod(A, A, len, c, fpctx);
+        _fmpz_vec_scalar_mul_fmpz(D, B, len, c);
+        _fmpz_vec_scalar_mod_fmpz(D, D, len, p);
+        if (!_fmpz_vec_equal(A, D, len))
+        {
+            flint_printf("FAIL\ncheck scalar mul\ni = %wd\n", i);
+            flint_abort();
+        }
+
+        /* dot */
+        _fmpz_mod_vec_dot(d, B, C, len, fpctx);
+        _fmpz_vec_dot(e, B, C, len);
+        fmpz_mod(e, e, p);
+        if (!fmpz_equal(d, e))
+        {
+            flint_printf("FAIL\ncheck dot\ni = %wd\n", i);
+            flint_abort();
+        }
+
+        _fmpz_vec_clear(A, len);
+        _fmpz_vec_clear(B, len);
+        _fmpz_vec_clear(C, len);
+        _fmpz_vec_clear(D, len);
+
+        fmpz_mod_ctx_clear(fpctx);
+        fmpz_clear(p);
+        fmpz_clear(c);
+        fmpz_clear(d);
+        fmpz_clear(e);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
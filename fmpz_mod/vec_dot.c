@@ -0,0 +1,50 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_mod.h"
+
+void _fmpz_mod_vec_dot(fmpz_t d, const fmpz * A, const fmpz * B,
+                                          slong len, const fmpz_mod_ctx_t ctx)
+{
+    slong i;
+
+    if (ctx->nlimbs != 0)
+    {
+        /* accumulate the products in 2k + 1 limbs and reduce once */
+        mp_size_t k = ctx->nlimbs;
+        mp_limb_t a[FMPZ_MOD_MPN_MAX_LIMBS], b[FMPZ_MOD_MPN_MAX_LIMBS];
+        mp_limb_t s[2*FMPZ_MOD_MPN_MAX_LIMBS + 2];
+        mp_limb_t t[2*FMPZ_MOD_MPN_MAX_LIMBS];
+
+        flint_mpn_zero(s, 2*k + 1);
+
+        for (i = 0; i < len; i++)
+        {
+            FLINT_ASSERT(fmpz_mod_is_canonical(A + i, ctx));
+            FLINT_ASSERT(fmpz_mod_is_canonical(B + i, ctx));
+
+            fmpz_get_ui_array(a, k, A + i);
+            fmpz_get_ui_array(b, k, B + i);
+            mpn_mul_n(t, a, b, k);
+            s[2*k] += mpn_add_n(s, s, t, 2*k);
+        }
+
+        _fmpz_mod_mpn_reduce(a, s, 2*k + 1, ctx);
+        fmpz_set_ui_array(d, a, k);
+    }
+    else
+    {
+        _fmpz_vec_dot(d, A, B, len);
+        fmpz_mod(d, d, ctx->n);
+    }
+
+    FLINT_ASSERT(fmpz_mod_is_canonical(d, ctx));
+}
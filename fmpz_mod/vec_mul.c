@@ -0,0 +1,21 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_mod.h"
+
+void _fmpz_mod_vec_mul(fmpz * A, const fmpz * B, const fmpz * C,
+                                          slong len, const fmpz_mod_ctx_t ctx)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+        (ctx->mul_fxn)(A + i, B + i, C + i, ctx);
+}
@@ -0,0 +1,48 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_mod.h"
+
+void _fmpz_mod_vec_scalar_mul_fmpz_mod(fmpz * A, const fmpz * B, slong len,
+                                     const fmpz_t c, const fmpz_mod_ctx_t ctx)
+{
+    slong i;
+
+    if (ctx->nlimbs != 0 && ctx->minv != 0 && len > 1)
+    {
+        /*
+            With c' = c*2^(FLINT_BITS*k) mod n, the Montgomery reduction of
+            b*c' is b*c mod n, so each entry costs one product and one redc
+        */
+        mp_size_t k = ctx->nlimbs;
+        mp_limb_t cc[FMPZ_MOD_MPN_MAX_LIMBS], b[FMPZ_MOD_MPN_MAX_LIMBS];
+        mp_limb_t t[2*FMPZ_MOD_MPN_MAX_LIMBS + 1];
+
+        flint_mpn_zero(t, k);
+        fmpz_get_ui_array(t + k, k, c);
+        _fmpz_mod_mpn_reduce(cc, t, 2*k, ctx);
+
+        for (i = 0; i < len; i++)
+        {
+            FLINT_ASSERT(fmpz_mod_is_canonical(B + i, ctx));
+
+            fmpz_get_ui_array(b, k, B + i);
+            mpn_mul_n(t, b, cc, k);
+            _fmpz_mod_mpn_redc(b, t, ctx);
+            fmpz_set_ui_array(A + i, b, k);
+        }
+    }
+    else
+    {
+        for (i = 0; i < len; i++)
+            fmpz_mod_mul(A + i, B + i, c, ctx);
+    }
+}
@@ -30,6 +30,7 @@
 #include "fmpz.h"
 #include "fmpz_poly.h"
 #include "fmpz_mat.h"
+#include "fmpz_mod.h"
 
 #ifdef __cplusplus
  extern "C" {
@@ -414,6 +415,43 @@ FLINT_DLL void fmpz_mod_poly_mulmod_preinv(fmpz_mod_poly_t res, const fmpz_mod_p
                          const fmpz_mod_poly_t poly2, const fmpz_mod_poly_t f,
                          const fmpz_mod_poly_t finv);
 
+/*  Packed coefficients ******************************************************/
+
+/*
+    If the modulus has between 3 and FMPZ_MOD_MPN_MAX_LIMBS limbs, i.e. if
+    ctx->nlimbs != 0, the coefficients can be stored as a contiguous array
+    of ctx->nlimbs limbs each and reduced with the fmpz_mod mpn kernels.
+    Multiplication and division with remainder are then done without any
+    allocation per coefficient.
+*/
+
+FLINT_DLL void _fmpz_mod_poly_mpn_pack(mp_ptr res, const fmpz * poly,
+                                   slong len, const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_mod_poly_mpn_unpack(fmpz * res, mp_srcptr poly,
+                                   slong len, const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_mod_poly_mpn_mullow(mp_ptr res, mp_srcptr poly1,
+                         slong len1, mp_srcptr poly2, slong len2, slong n,
+                         const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_mod_poly_mpn_divrem_newton_n_preinv(mp_ptr Q, mp_ptr R,
+                     mp_srcptr A, slong lenA, mp_srcptr B, slong lenB,
+                     mp_srcptr Binv, slong lenBinv, const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_mod_poly_mpn_mulmod_preinv(mp_ptr res, mp_srcptr poly1,
+                     slong len1, mp_srcptr poly2, slong len2,
+                     mp_srcptr f, slong lenf, mp_srcptr finv, slong lenfinv,
+                     const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_mod_poly_mpn_powmod_fmpz_preinv(mp_ptr res,
+                     mp_srcptr poly, const fmpz_t e, mp_srcptr f, slong lenf,
+                     mp_srcptr finv, slong lenfinv, const fmpz_mod_ctx_t ctx);
+
+FLINT_DLL void _fmpz_mod_poly_mpn_powmod_x_fmpz_preinv(mp_ptr res,
+                     const fmpz_t e, mp_srcptr f, slong lenf,
+                     mp_srcptr finv, slong lenfinv, const fmpz_mod_ctx_t ctx);
+
 /*  Powering *****************************************************************/
 
 FLINT_DLL void _fmpz_mod_poly_pow(fmpz *rop, const fmpz *op, slong len, ulong e, 
@@ -0,0 +1,68 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_mod_poly.h"
+
+static void
+_mpn_poly_reverse(mp_ptr res, mp_srcptr poly, slong len, mp_size_t k)
+{
+    slong i;
+
+    if (res == poly)
+    {
+        mp_limb_t t[FMPZ_MOD_MPN_MAX_LIMBS];
+
+        for (i = 0; i < len/2; i++)
+        {
+            flint_mpn_copyi(t, res + i*k, k);
+            flint_mpn_copyi(res + i*k, res + (len - 1 - i)*k, k);
+            flint_mpn_copyi(res + (len - 1 - i)*k, t, k);
+        }
+    }
+    else
+    {
+        for (i = 0; i < len; i++)
+            flint_mpn_copyi(res + i*k, poly + (len - 1 - i)*k, k);
+    }
+}
+
+void _fmpz_mod_poly_mpn_divrem_newton_n_preinv(mp_ptr Q, mp_ptr R,
+                     mp_srcptr A, slong lenA, mp_srcptr B, slong lenB,
+                     mp_srcptr Binv, slong lenBinv, const fmpz_mod_ctx_t ctx)
+{
+    const slong lenQ = lenA - lenB + 1;
+    mp_size_t k = ctx->nlimbs;
+    mp_srcptr n = COEFF_TO_PTR(*ctx->n)->_mp_d;
+    mp_ptr Arev;
+    slong i;
+
+    FLINT_ASSERT(lenB <= lenA && lenA <= 2*lenB - 1);
+
+    Arev = (mp_ptr) flint_malloc(lenQ*k*sizeof(mp_limb_t));
+
+    _mpn_poly_reverse(Arev, A + (lenA - lenQ)*k, lenQ, k);
+    _fmpz_mod_poly_mpn_mullow(Q, Arev, lenQ, Binv, FLINT_MIN(lenQ, lenBinv),
+                                                                lenQ, ctx);
+    _mpn_poly_reverse(Q, Q, lenQ, k);
+
+    flint_free(Arev);
+
+    if (lenB > 1)
+    {
+        _fmpz_mod_poly_mpn_mullow(R, Q, lenQ, B, lenB - 1, lenB - 1, ctx);
+
+        for (i = 0; i < lenB - 1; i++)
+        {
+            if (mpn_sub_n(R + i*k, A + i*k, R + i*k, k))
+                mpn_add_n(R + i*k, R + i*k, n, k);
+        }
+    }
+}
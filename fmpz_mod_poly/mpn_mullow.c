@@ -0,0 +1,304 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_mod_poly.h"
+#include "fft.h"
+
+#if HAVE_OPENMP
+#include <omp.h> /* must be after flint.h */
+#endif
+
+/*
+    Pack the len coefficients of k limbs each at A into fields of b bits
+    at res, which must be zero and have space for (len*b)/FLINT_BITS + k + 1
+    limbs.
+*/
+static void
+_mpn_bit_pack(mp_ptr res, mp_srcptr A, slong len, mp_size_t k,
+                                                           mp_bitcnt_t b)
+{
+    slong i;
+    mp_size_t j;
+    mp_limb_t t[FMPZ_MOD_MPN_MAX_LIMBS];
+
+    for (i = 0; i < len; i++, A += k)
+    {
+        mp_ptr r = res + (i*b)/FLINT_BITS;
+        unsigned int s = (i*b) % FLINT_BITS;
+
+        if (s == 0)
+        {
+            for (j = 0; j < k; j++)
+                r[j] |= A[j];
+        }
+        else
+        {
+            r[k] |= mpn_lshift(t, A, k, s);
+            for (j = 0; j < k; j++)
+                r[j] |= t[j];
+        }
+    }
+}
+
+static void
+_mpn_mul_KS(mp_ptr res, mp_srcptr arr1, mp_size_t limbs1,
+                        mp_srcptr arr2, mp_size_t limbs2, int sqr)
+{
+    if (sqr)
+    {
+        if (limbs1 < 2000)
+            mpn_sqr(res, arr1, limbs1);
+        else
+            flint_mpn_mul_fft_main(res, arr1, limbs1, arr1, limbs1);
+    }
+    else if (limbs1 >= limbs2)
+    {
+        if (limbs2 < 1000)
+            mpn_mul(res, arr1, limbs1, arr2, limbs2);
+        else
+            flint_mpn_mul_fft_main(res, arr1, limbs1, arr2, limbs2);
+    }
+    else
+    {
+        if (limbs1 < 1000)
+            mpn_mul(res, arr2, limbs2, arr1, limbs1);
+        else
+            flint_mpn_mul_fft_main(res, arr2, limbs2, arr1, limbs1);
+    }
+}
+
+/*
+    Classical multiplication: each output coefficient is accumulated in
+    2*k + 1 limbs and reduced once.
+*/
+static void
+_mpn_mullow_classical(mp_ptr res, mp_srcptr poly1, slong len1,
+                   mp_srcptr poly2, slong len2, slong n,
+                   const fmpz_mod_ctx_t ctx)
+{
+    mp_size_t k = ctx->nlimbs;
+    mp_limb_t s[2*FMPZ_MOD_MPN_MAX_LIMBS + 2], t[2*FMPZ_MOD_MPN_MAX_LIMBS];
+    slong i, j;
+
+    for (i = 0; i < n; i++)
+    {
+        flint_mpn_zero(s, 2*k + 1);
+
+        for (j = FLINT_MAX(0, i - len2 + 1); j <= FLINT_MIN(i, len1 - 1); j++)
+        {
+            mpn_mul_n(t, poly1 + j*k, poly2 + (i - j)*k, k);
+            s[2*k] += mpn_add_n(s, s, t, 2*k);
+        }
+
+        _fmpz_mod_mpn_reduce(res + i*k, s, 2*k + 1, ctx);
+    }
+}
+
+/*
+    Kronecker substitution: the coefficients of the integer product are
+    sums of at most min(len1, len2) products of residues, so fields of
+    2*bits(n) + clog2(min(len1, len2)) bits suffice. Each field is reduced
+    straight into its packed output slot.
+*/
+static void
+_mpn_mullow_KS(mp_ptr res, mp_srcptr poly1, slong len1,
+                   mp_srcptr poly2, slong len2, slong n,
+                   const fmpz_mod_ctx_t ctx)
+{
+    mp_size_t k = ctx->nlimbs, limbs1, limbs2, m, tn;
+    mp_limb_t t[2*FMPZ_MOD_MPN_MAX_LIMBS + 4];
+    mp_ptr arr1, arr2, arr3;
+    mp_bitcnt_t b;
+    int sqr = (poly1 == poly2 && len1 == len2);
+    slong i;
+
+    b = 2*fmpz_bits(ctx->n) + FLINT_CLOG2(FLINT_MIN(len1, len2));
+
+    limbs1 = (len1*b - 1)/FLINT_BITS + 1;
+    limbs2 = (len2*b - 1)/FLINT_BITS + 1;
+
+    arr1 = (mp_ptr) flint_calloc(2*(limbs1 + limbs2 + k + 1), sizeof(mp_limb_t));
+    arr2 = arr1 + limbs1 + k + 1;
+    arr3 = arr2 + limbs2 + k + 1;
+
+    _mpn_bit_pack(arr1, poly1, len1, k, b);
+    if (!sqr)
+        _mpn_bit_pack(arr2, poly2, len2, k, b);
+
+    _mpn_mul_KS(arr3, arr1, limbs1, arr2, limbs2, sqr);
+
+    m = (b - 1)/FLINT_BITS + 1;
+
+    for (i = 0; i < n; i++)
+    {
+        mp_srcptr r = arr3 + (i*b)/FLINT_BITS;
+        unsigned int s = (i*b) % FLINT_BITS;
+        mp_size_t avail = limbs1 + limbs2 - (i*b)/FLINT_BITS;
+
+        tn = FLINT_MIN(m + 1, avail);
+
+        if (s == 0)
+            flint_mpn_copyi(t, r, tn);
+        else
+            mpn_rshift(t, r, tn, s);
+
+        for (tn = FLINT_MIN(m, tn); tn < m; tn++)
+            t[tn] = 0;
+
+        if (b % FLINT_BITS)
+            t[m - 1] &= (UWORD(1) << (b % FLINT_BITS)) - 1;
+
+        while (tn > k && t[tn - 1] == 0)
+            tn--;
+
+        _fmpz_mod_mpn_reduce(res + i*k, t, tn, ctx);
+    }
+
+    flint_free(arr1);
+}
+
+/* as _fmpz_poly_mullow_SS, with the coefficients already in limb arrays */
+static void
+_mpn_mullow_SS(mp_ptr res, mp_srcptr poly1, slong len1,
+                   mp_srcptr poly2, slong len2, slong trunc,
+                   const fmpz_mod_ctx_t ctx)
+{
+    mp_size_t k = ctx->nlimbs, tn;
+    slong len_out, loglen, loglen2, n;
+    slong output_bits, limbs, size, i;
+    mp_limb_t * ptr, ** t1, ** t2, ** tt, ** s1, ** ii, ** jj;
+    int sqr = (poly1 == poly2 && len1 == len2);
+#if HAVE_OPENMP
+    int N;
+#endif
+    TMP_INIT;
+
+    TMP_START;
+
+    len_out = len1 + len2 - 1;
+    loglen  = FLINT_CLOG2(len_out);
+    loglen2 = FLINT_CLOG2(FLINT_MIN(len1, len2));
+    n = (WORD(1) << (loglen - 2));
+
+    output_bits = 2*fmpz_bits(ctx->n) + loglen2;
+
+    /* round up for sqrt2 trick */
+    output_bits = (((output_bits - 1) >> (loglen - 2)) + 1) << (loglen - 2);
+
+    limbs = (output_bits - 1) / FLINT_BITS + 1;
+    limbs = fft_adjust_limbs(limbs); /* round up limbs for Nussbaumer */
+    size = limbs + 1;
+
+#if HAVE_OPENMP
+    N = omp_get_max_threads();
+    ii = flint_malloc((4*(n + n*size) + 5*size*N)*sizeof(mp_limb_t));
+#else
+    ii = flint_malloc((4*(n + n*size) + 5*size)*sizeof(mp_limb_t));
+#endif
+    for (i = 0, ptr = (mp_limb_t *) ii + 4*n; i < 4*n; i++, ptr += size)
+        ii[i] = ptr;
+#if HAVE_OPENMP
+    t1 = TMP_ALLOC(N*sizeof(mp_limb_t *));
+    t2 = TMP_ALLOC(N*sizeof(mp_limb_t *));
+    s1 = TMP_ALLOC(N*sizeof(mp_limb_t *));
+    tt = TMP_ALLOC(N*sizeof(mp_limb_t *));
+
+    t1[0] = ptr;
+    t2[0] = t1[0] + size*N;
+    s1[0] = t2[0] + size*N;
+    tt[0] = s1[0] + size*N;
+
+    for (i = 1; i < N; i++)
+    {
+        t1[i] = t1[i - 1] + size;
+        t2[i] = t2[i - 1] + size;
+        s1[i] = s1[i - 1] + size;
+        tt[i] = tt[i - 1] + 2*size;
+    }
+#else
+    t1 = TMP_ALLOC(sizeof(mp_limb_t *));
+    t2 = TMP_ALLOC(sizeof(mp_limb_t *));
+    s1 = TMP_ALLOC(sizeof(mp_limb_t *));
+    tt = TMP_ALLOC(sizeof(mp_limb_t *));
+
+    t1[0] = ptr;
+    t2[0] = t1[0] + size;
+    s1[0] = t2[0] + size;
+    tt[0] = s1[0] + size;
+#endif
+
+    for (i = 0; i < len1; i++)
+    {
+        flint_mpn_copyi(ii[i], poly1 + i*k, k);
+        flint_mpn_zero(ii[i] + k, size - k);
+    }
+    for ( ; i < 4*n; i++)
+        flint_mpn_zero(ii[i], size);
+
+    if (!sqr)
+    {
+        jj = flint_malloc(4*(n + n*size)*sizeof(mp_limb_t));
+        for (i = 0, ptr = (mp_limb_t *) jj + 4*n; i < 4*n; i++, ptr += size)
+            jj[i] = ptr;
+
+        for (i = 0; i < len2; i++)
+        {
+            flint_mpn_copyi(jj[i], poly2 + i*k, k);
+            flint_mpn_zero(jj[i] + k, size - k);
+        }
+        for ( ; i < 4*n; i++)
+            flint_mpn_zero(jj[i], size);
+    }
+    else
+        jj = ii;
+
+    fft_convolution(ii, jj, loglen - 2, limbs, len_out, t1, t2, s1, tt);
+
+    /* the output coefficients are nonnegative and fit into limbs limbs */
+    for (i = 0; i < trunc; i++)
+    {
+        tn = limbs;
+        while (tn > k && ii[i][tn - 1] == 0)
+            tn--;
+
+        _fmpz_mod_mpn_reduce(res + i*k, ii[i], tn, ctx);
+    }
+
+    flint_free(ii);
+    if (!sqr)
+        flint_free(jj);
+
+    TMP_END;
+}
+
+/*
+    The choice of algorithm follows _fmpz_poly_mullow for coefficients
+    of ctx->nlimbs limbs.
+*/
+void _fmpz_mod_poly_mpn_mullow(mp_ptr res, mp_srcptr poly1, slong len1,
+                         mp_srcptr poly2, slong len2, slong n,
+                         const fmpz_mod_ctx_t ctx)
+{
+    mp_size_t k = ctx->nlimbs;
+
+    FLINT_ASSERT(len1 > 0 && len2 > 0);
+    FLINT_ASSERT(n > 0 && n <= len1 + len2 - 1);
+
+    len1 = FLINT_MIN(len1, n);
+    len2 = FLINT_MIN(len2, n);
+
+    if (FLINT_MIN(len1, len2) < 7)
+        _mpn_mullow_classical(res, poly1, len1, poly2, len2, n, ctx);
+    else if (2*k <= 8 || 2*k*FLINT_BITS*4 < len1 + len2)
+        _mpn_mullow_KS(res, poly1, len1, poly2, len2, n, ctx);
+    else
+        _mpn_mullow_SS(res, poly1, len1, poly2, len2, n, ctx);
+}
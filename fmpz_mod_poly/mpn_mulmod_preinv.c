@@ -0,0 +1,33 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_mod_poly.h"
+
+void _fmpz_mod_poly_mpn_mulmod_preinv(mp_ptr res, mp_srcptr poly1,
+                     slong len1, mp_srcptr poly2, slong len2,
+                     mp_srcptr f, slong lenf, mp_srcptr finv, slong lenfinv,
+                     const fmpz_mod_ctx_t ctx)
+{
+    mp_size_t k = ctx->nlimbs;
+    slong lenT = len1 + len2 - 1, lenQ = lenT - lenf + 1;
+    mp_ptr T, Q;
+
+    FLINT_ASSERT(lenQ > 0);
+
+    T = (mp_ptr) flint_malloc((lenT + lenQ)*k*sizeof(mp_limb_t));
+    Q = T + lenT*k;
+
+    _fmpz_mod_poly_mpn_mullow(T, poly1, len1, poly2, len2, lenT, ctx);
+    _fmpz_mod_poly_mpn_divrem_newton_n_preinv(Q, res, T, lenT, f, lenf,
+                                                        finv, lenfinv, ctx);
+
+    flint_free(T);
+}
@@ -0,0 +1,35 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_mod_poly.h"
+
+void _fmpz_mod_poly_mpn_pack(mp_ptr res, const fmpz * poly, slong len,
+                                                     const fmpz_mod_ctx_t ctx)
+{
+    slong i;
+    mp_size_t k = ctx->nlimbs;
+
+    for (i = 0; i < len; i++)
+    {
+        FLINT_ASSERT(fmpz_mod_is_canonical(poly + i, ctx));
+        fmpz_get_ui_array(res + i*k, k, poly + i);
+    }
+}
+
+void _fmpz_mod_poly_mpn_unpack(fmpz * res, mp_srcptr poly, slong len,
+                                                     const fmpz_mod_ctx_t ctx)
+{
+    slong i;
+    mp_size_t k = ctx->nlimbs;
+
+    for (i = 0; i < len; i++)
+        fmpz_set_ui_array(res + i, poly + i*k, k);
+}
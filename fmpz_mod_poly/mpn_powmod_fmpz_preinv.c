@@ -0,0 +1,46 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_mod_poly.h"
+
+void _fmpz_mod_poly_mpn_powmod_fmpz_preinv(mp_ptr res, mp_srcptr poly,
+                     const fmpz_t e, mp_srcptr f, slong lenf,
+                     mp_srcptr finv, slong lenfinv, const fmpz_mod_ctx_t ctx)
+{
+    mp_size_t k = ctx->nlimbs;
+    slong lenT = 2*lenf - 3, lenQ = lenT - lenf + 1;
+    mp_ptr T, Q;
+    slong i;
+
+    FLINT_ASSERT(lenf > 2);
+
+    T = (mp_ptr) flint_malloc((lenT + lenQ)*k*sizeof(mp_limb_t));
+    Q = T + lenT*k;
+
+    flint_mpn_copyi(res, poly, (lenf - 1)*k);
+
+    for (i = fmpz_sizeinbase(e, 2) - 2; i >= 0; i--)
+    {
+        _fmpz_mod_poly_mpn_mullow(T, res, lenf - 1, res, lenf - 1, lenT, ctx);
+        _fmpz_mod_poly_mpn_divrem_newton_n_preinv(Q, res, T, lenT, f, lenf,
+                                                        finv, lenfinv, ctx);
+
+        if (fmpz_tstbit(e, i))
+        {
+            _fmpz_mod_poly_mpn_mullow(T, res, lenf - 1, poly, lenf - 1,
+                                                                 lenT, ctx);
+            _fmpz_mod_poly_mpn_divrem_newton_n_preinv(Q, res, T, lenT, f,
+                                                  lenf, finv, lenfinv, ctx);
+        }
+    }
+
+    flint_free(T);
+}
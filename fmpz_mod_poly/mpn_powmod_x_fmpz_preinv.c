@@ -0,0 +1,84 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_mod_poly.h"
+
+#include "long_extras.h"
+
+/* sliding window over the exponent, as in _fmpz_mod_poly_powmod_x_fmpz_preinv */
+void _fmpz_mod_poly_mpn_powmod_x_fmpz_preinv(mp_ptr res, const fmpz_t e,
+                     mp_srcptr f, slong lenf, mp_srcptr finv, slong lenfinv,
+                     const fmpz_mod_ctx_t ctx)
+{
+    mp_size_t k = ctx->nlimbs;
+    slong lenT = 2*lenf - 3, lenQ = lenT - lenf + 1;
+    slong i, window, l, c;
+    mp_ptr T, Q;
+
+    FLINT_ASSERT(lenf > 2);
+
+    T = (mp_ptr) flint_malloc((lenT + lenQ)*k*sizeof(mp_limb_t));
+    Q = T + lenT*k;
+
+    flint_mpn_zero(res, (lenf - 1)*k);
+    res[0] = 1;
+
+    l = z_sizeinbase(lenf - 1, 2) - 2;
+    window = (WORD(1) << l);
+    c = l;
+    i = fmpz_sizeinbase(e, 2) - 2;
+    if (i <= l)
+    {
+        window = (WORD(1) << i);
+        c = i;
+        l = i;
+    }
+
+    if (c == 0)
+    {
+        flint_mpn_zero(T, window*k);
+        flint_mpn_copyi(T + window*k, res, (lenf - 1)*k);
+        _fmpz_mod_poly_mpn_divrem_newton_n_preinv(Q, res, T,
+                        lenf - 1 + window, f, lenf, finv, lenfinv, ctx);
+        c = l + 1;
+        window = WORD(0);
+    }
+
+    for ( ; i >= 0; i--)
+    {
+        _fmpz_mod_poly_mpn_mullow(T, res, lenf - 1, res, lenf - 1, lenT, ctx);
+        _fmpz_mod_poly_mpn_divrem_newton_n_preinv(Q, res, T, lenT, f, lenf,
+                                                        finv, lenfinv, ctx);
+
+        c--;
+        if (fmpz_tstbit(e, i))
+        {
+            if (window == WORD(0) && i <= l - 1)
+                c = i;
+            if (c >= 0)
+                window = window | (WORD(1) << c);
+        }
+        else if (window == WORD(0))
+            c = l + 1;
+
+        if (c == 0)
+        {
+            flint_mpn_zero(T, window*k);
+            flint_mpn_copyi(T + window*k, res, (lenf - 1)*k);
+            _fmpz_mod_poly_mpn_divrem_newton_n_preinv(Q, res, T,
+                        lenf - 1 + window, f, lenf, finv, lenfinv, ctx);
+            c = l + 1;
+            window = WORD(0);
+        }
+    }
+
+    flint_free(T);
+}
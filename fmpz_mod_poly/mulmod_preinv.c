@@ -32,6 +32,38 @@ void _fmpz_mod_poly_mulmod_preinv(fmpz * res, const fmpz * poly1, slong len1,
 {
     fmpz * T, * Q;
     slong lenT, lenQ;
+    fmpz_mod_ctx_t ctx;
+
+    fmpz_mod_ctx_init(ctx, p);
+
+    if (ctx->nlimbs != 0)
+    {
+        mp_size_t k = ctx->nlimbs;
+        mp_ptr P1, P2, F, Finv, R;
+
+        P1 = (mp_ptr) flint_malloc((len1 + len2 + 2*lenf - 1 + lenfinv)*k
+                                                        *sizeof(mp_limb_t));
+        P2 = P1 + len1*k;
+        F = P2 + len2*k;
+        Finv = F + lenf*k;
+        R = Finv + lenfinv*k;
+
+        _fmpz_mod_poly_mpn_pack(P1, poly1, len1, ctx);
+        _fmpz_mod_poly_mpn_pack(P2, poly2, len2, ctx);
+        _fmpz_mod_poly_mpn_pack(F, f, lenf, ctx);
+        _fmpz_mod_poly_mpn_pack(Finv, finv, lenfinv, ctx);
+
+        _fmpz_mod_poly_mpn_mulmod_preinv(R, P1, len1, P2, len2, F, lenf,
+                                                     Finv, lenfinv, ctx);
+
+        _fmpz_mod_poly_mpn_unpack(res, R, lenf - 1, ctx);
+
+        flint_free(P1);
+        fmpz_mod_ctx_clear(ctx);
+        return;
+    }
+
+    fmpz_mod_ctx_clear(ctx);
 
     lenT = len1 + len2 - 1;
     lenQ = lenT - lenf + 1;
@@ -37,6 +37,7 @@ _fmpz_mod_poly_powmod_fmpz_binexp_preinv(fmpz * res, const fmpz * poly,
     fmpz * T, * Q;
     slong lenT, lenQ;
     slong i;
+    fmpz_mod_ctx_t ctx;
 
     if (lenf == 2)
     {
@@ -44,6 +45,34 @@ _fmpz_mod_poly_powmod_fmpz_binexp_preinv(fmpz * res, const fmpz * poly,
         return;
     }
 
+    fmpz_mod_ctx_init(ctx, p);
+
+    if (ctx->nlimbs != 0)
+    {
+        mp_size_t k = ctx->nlimbs;
+        mp_ptr P, F, Finv, R;
+
+        P = (mp_ptr) flint_malloc((3*lenf - 2 + lenfinv)*k*sizeof(mp_limb_t));
+        F = P + (lenf - 1)*k;
+        Finv = F + lenf*k;
+        R = Finv + lenfinv*k;
+
+        _fmpz_mod_poly_mpn_pack(P, poly, lenf - 1, ctx);
+        _fmpz_mod_poly_mpn_pack(F, f, lenf, ctx);
+        _fmpz_mod_poly_mpn_pack(Finv, finv, lenfinv, ctx);
+
+        _fmpz_mod_poly_mpn_powmod_fmpz_preinv(R, P, e, F, lenf,
+                                                     Finv, lenfinv, ctx);
+
+        _fmpz_mod_poly_mpn_unpack(res, R, lenf - 1, ctx);
+
+        flint_free(P);
+        fmpz_mod_ctx_clear(ctx);
+        return;
+    }
+
+    fmpz_mod_ctx_clear(ctx);
+
     lenT = 2 * lenf - 3;
     lenQ = lenT - lenf + 1;
 
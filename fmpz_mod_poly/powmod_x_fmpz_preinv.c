@@ -37,6 +37,33 @@ _fmpz_mod_poly_powmod_x_fmpz_preinv(fmpz * res, const fmpz_t e, const fmpz * f,
     fmpz * T, * Q;
     slong lenT, lenQ;
     slong i, window, l, c;
+    fmpz_mod_ctx_t ctx;
+
+    fmpz_mod_ctx_init(ctx, p);
+
+    if (ctx->nlimbs != 0)
+    {
+        mp_size_t k = ctx->nlimbs;
+        mp_ptr F, Finv, R;
+
+        F = (mp_ptr) flint_malloc((2*lenf - 1 + lenfinv)*k*sizeof(mp_limb_t));
+        Finv = F + lenf*k;
+        R = Finv + lenfinv*k;
+
+        _fmpz_mod_poly_mpn_pack(F, f, lenf, ctx);
+        _fmpz_mod_poly_mpn_pack(Finv, finv, lenfinv, ctx);
+
+        _fmpz_mod_poly_mpn_powmod_x_fmpz_preinv(R, e, F, lenf,
+                                                     Finv, lenfinv, ctx);
+
+        _fmpz_mod_poly_mpn_unpack(res, R, lenf - 1, ctx);
+
+        flint_free(F);
+        fmpz_mod_ctx_clear(ctx);
+        return;
+    }
+
+    fmpz_mod_ctx_clear(ctx);
 
     lenT = 2 * lenf - 3;
     lenQ = lenT - lenf + 1;
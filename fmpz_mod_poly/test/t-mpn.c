@@ -0,0 +1,197 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include "fmpz_mod_poly.h"
+
+/* random modulus of 3 to 7 limbs, not necessarily prime */
+static void
+_randtest_modulus(fmpz_t p, flint_rand_t state)
+{
+    slong bits = 2*FLINT_BITS + 1 + n_randint(state, 5*FLINT_BITS);
+
+    if (n_randint(state, 2))
+        fmpz_randprime(p, state, bits, 0);
+    else
+    {
+        fmpz_randbits(p, state, bits);
+        fmpz_abs(p, p);
+    }
+}
+
+int
+main(void)
+{
+    int i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mpn....");
+    fflush(stdout);
+
+    /* mpn_mullow against mullow */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p;
+        fmpz_mod_poly_t a, b, c, d;
+        fmpz_mod_ctx_t ctx;
+        mp_ptr A, B, C;
+        slong n, k;
+
+        fmpz_init(p);
+        _randtest_modulus(p, state);
+        fmpz_mod_ctx_init(ctx, p);
+        k = ctx->nlimbs;
+
+        fmpz_mod_poly_init(a, p);
+        fmpz_mod_poly_init(b, p);
+        fmpz_mod_poly_init(c, p);
+        fmpz_mod_poly_init(d, p);
+
+        fmpz_mod_poly_randtest_not_zero(a, state, n_randint(state, 60) + 1);
+        if (n_randint(state, 4) == 0)
+            fmpz_mod_poly_set(b, a);
+        else
+            fmpz_mod_poly_randtest_not_zero(b, state, n_randint(state, 60) + 1);
+        n = n_randint(state, a->length + b->length - 1) + 1;
+
+        A = flint_malloc((a->length + b->length + n)*k*sizeof(mp_limb_t));
+        B = A + a->length*k;
+        C = B + b->length*k;
+
+        _fmpz_mod_poly_mpn_pack(A, a->coeffs, a->length, ctx);
+        _fmpz_mod_poly_mpn_pack(B, b->coeffs, b->length, ctx);
+        _fmpz_mod_poly_mpn_mullow(C, A, a->length,
+                         fmpz_mod_poly_equal(a, b) ? A : B, b->length, n, ctx);
+
+        fmpz_mod_poly_fit_length(c, n);
+        _fmpz_mod_poly_mpn_unpack(c->coeffs, C, n, ctx);
+        _fmpz_mod_poly_set_length(c, n);
+        _fmpz_mod_poly_normalise(c);
+
+        fmpz_mod_poly_mullow(d, a, b, n);
+
+        if (!fmpz_mod_poly_equal(c, d))
+        {
+            flint_printf("FAIL (mullow):\n");
+            flint_printf("p = "), fmpz_print(p), flint_printf("\n\n");
+            flint_printf("a = "), fmpz_mod_poly_print(a), flint_printf("\n\n");
+            flint_printf("b = "), fmpz_mod_poly_print(b), flint_printf("\n\n");
+            flint_printf("n = %wd\n", n);
+            abort();
+        }
+
+        flint_free(A);
+        fmpz_mod_poly_clear(a);
+        fmpz_mod_poly_clear(b);
+        fmpz_mod_poly_clear(c);
+        fmpz_mod_poly_clear(d);
+        fmpz_mod_ctx_clear(ctx);
+        fmpz_clear(p);
+    }
+
+    /* mulmod_preinv and powmod_preinv against the versions without inverse */
+    for (i = 0; i < 30 * flint_test_multiplier(); i++)
+    {
+        fmpz_t p, e;
+        fmpz_mod_poly_t a, b, f, finv, x, r1, r2;
+        ulong eu;
+
+        fmpz_init(p);
+        fmpz_init(e);
+        _randtest_modulus(p, state);
+
+        fmpz_mod_poly_init(a, p);
+        fmpz_mod_poly_init(b, p);
+        fmpz_mod_poly_init(finv, p);
+        fmpz_mod_poly_init(x, p);
+        fmpz_mod_poly_init(r1, p);
+        fmpz_mod_poly_init(r2, p);
+        fmpz_mod_poly_init(f, p);
+
+        /* monic, so that f is invertible for non-prime moduli */
+        fmpz_mod_poly_randtest_monic(f, state, n_randint(state, 40) + 3);
+        fmpz_mod_poly_randtest(a, state, f->length - 1);
+        fmpz_mod_poly_randtest(b, state, f->length - 1);
+        fmpz_mod_poly_reverse(finv, f, f->length);
+        fmpz_mod_poly_inv_series_newton(finv, finv, f->length);
+
+        fmpz_mod_poly_mulmod_preinv(r1, a, b, f, finv);
+        fmpz_mod_poly_mulmod(r2, a, b, f);
+
+        if (!fmpz_mod_poly_equal(r1, r2))
+        {
+            flint_printf("FAIL (mulmod_preinv):\n");
+            flint_printf("p = "), fmpz_print(p), flint_printf("\n\n");
+            flint_printf("a = "), fmpz_mod_poly_print(a), flint_printf("\n\n");
+            flint_printf("b = "), fmpz_mod_poly_print(b), flint_printf("\n\n");
+            flint_printf("f = "), fmpz_mod_poly_print(f), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_randtest_unsigned(e, state, 100);
+
+        fmpz_mod_poly_powmod_fmpz_binexp_preinv(r1, a, e, f, finv);
+        fmpz_mod_poly_powmod_fmpz_binexp(r2, a, e, f);
+
+        if (!fmpz_mod_poly_equal(r1, r2))
+        {
+            flint_printf("FAIL (powmod_fmpz_binexp_preinv):\n");
+            flint_printf("p = "), fmpz_print(p), flint_printf("\n\n");
+            flint_printf("a = "), fmpz_mod_poly_print(a), flint_printf("\n\n");
+            flint_printf("e = "), fmpz_print(e), flint_printf("\n\n");
+            flint_printf("f = "), fmpz_mod_poly_print(f), flint_printf("\n\n");
+            abort();
+        }
+
+        eu = n_randtest(state);
+
+        fmpz_mod_poly_powmod_ui_binexp_preinv(r1, a, eu, f, finv);
+        fmpz_mod_poly_powmod_ui_binexp(r2, a, eu, f);
+
+        if (!fmpz_mod_poly_equal(r1, r2))
+        {
+            flint_printf("FAIL (powmod_ui_binexp_preinv):\n");
+            flint_printf("p = "), fmpz_print(p), flint_printf("\n\n");
+            flint_printf("a = "), fmpz_mod_poly_print(a), flint_printf("\n\n");
+            flint_printf("e = %wu\n\n", eu);
+            flint_printf("f = "), fmpz_mod_poly_print(f), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_mod_poly_set_coeff_ui(x, 1, 1);
+        fmpz_mod_poly_powmod_x_fmpz_preinv(r1, e, f, finv);
+        fmpz_mod_poly_powmod_fmpz_binexp(r2, x, e, f);
+
+        if (!fmpz_mod_poly_equal(r1, r2))
+        {
+            flint_printf("FAIL (powmod_x_fmpz_preinv):\n");
+            flint_printf("p = "), fmpz_print(p), flint_printf("\n\n");
+            flint_printf("e = "), fmpz_print(e), flint_printf("\n\n");
+            flint_printf("f = "), fmpz_mod_poly_print(f), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_mod_poly_clear(a);
+        fmpz_mod_poly_clear(b);
+        fmpz_mod_poly_clear(f);
+        fmpz_mod_poly_clear(finv);
+        fmpz_mod_poly_clear(x);
+        fmpz_mod_poly_clear(r1);
+        fmpz_mod_poly_clear(r2);
+        fmpz_clear(p);
+        fmpz_clear(e);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -273,6 +273,9 @@ struct fmpz_mod_poly_data
         fmpz_mod_poly_init(inner, fmpz_mod_poly_modulus(o.inner));
         fmpz_mod_poly_set(inner, o.inner);
     }
+    FLINTXX_DEFINE_DATA_MOVE(fmpz_mod_poly_data,
+            fmpz_mod_poly_init(inner, &o.inner->p),
+            std::swap(*inner, *o.inner))
 
     fmpz_mod_poly_data(fmpz_mod_polyxx_srcref r)
     {
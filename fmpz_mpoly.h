@@ -1216,6 +1216,38 @@ FLINT_DLL int fmpz_mpoly_geobucket_divides_inplace(fmpz_mpoly_geobucket_t B1,
                         fmpz_mpoly_geobucket_t B2, const fmpz_mpoly_ctx_t ctx);
 
 
+/* builders ******************************************************************/
+
+typedef struct fmpz_mpoly_builder
+{
+    fmpz * coeffs;
+    slong alloc;
+    mpoly_exp_builder_t exps;
+} fmpz_mpoly_builder_struct;
+
+typedef fmpz_mpoly_builder_struct fmpz_mpoly_builder_t[1];
+
+FLINT_DLL void fmpz_mpoly_builder_init(fmpz_mpoly_builder_t B, slong alloc,
+                                                   const fmpz_mpoly_ctx_t ctx);
+
+FLINT_DLL void fmpz_mpoly_builder_clear(fmpz_mpoly_builder_t B,
+                                                   const fmpz_mpoly_ctx_t ctx);
+
+FLINT_DLL void fmpz_mpoly_builder_fit_length(fmpz_mpoly_builder_t B,
+                                        slong len, const fmpz_mpoly_ctx_t ctx);
+
+FLINT_DLL void fmpz_mpoly_builder_push_terms_fmpz_ui(fmpz_mpoly_builder_t B,
+                         const fmpz * c, const ulong * exps, slong len,
+                                                   const fmpz_mpoly_ctx_t ctx);
+
+FLINT_DLL void fmpz_mpoly_builder_push_terms_fmpz_fmpz(fmpz_mpoly_builder_t B,
+                          const fmpz * c, const fmpz * exps, slong len,
+                                                   const fmpz_mpoly_ctx_t ctx);
+
+FLINT_DLL void fmpz_mpoly_builder_finish(fmpz_mpoly_t A,
+                           fmpz_mpoly_builder_t B, const fmpz_mpoly_ctx_t ctx);
+
+
 /* Helpers for array methods *************************************************/
 
 FLINT_DLL void _fmpz_mpoly_mul_array_chunked_DEG(fmpz_mpoly_t P,
@@ -0,0 +1,108 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_mpoly.h"
+
+void fmpz_mpoly_builder_init(fmpz_mpoly_builder_t B, slong alloc,
+                                                    const fmpz_mpoly_ctx_t ctx)
+{
+    alloc = FLINT_MAX(alloc, 0);
+    B->coeffs = (alloc > 0) ? (fmpz *) flint_calloc(alloc, sizeof(fmpz))
+                            : NULL;
+    B->alloc = alloc;
+    mpoly_exp_builder_init(B->exps, alloc, ctx->minfo);
+}
+
+void fmpz_mpoly_builder_clear(fmpz_mpoly_builder_t B,
+                                                    const fmpz_mpoly_ctx_t ctx)
+{
+    slong i;
+
+    for (i = 0; i < B->alloc; i++)
+        fmpz_clear(B->coeffs + i);
+
+    if (B->coeffs != NULL)
+        flint_free(B->coeffs);
+
+    mpoly_exp_builder_clear(B->exps, ctx->minfo);
+}
+
+void fmpz_mpoly_builder_fit_length(fmpz_mpoly_builder_t B, slong len,
+                                                    const fmpz_mpoly_ctx_t ctx)
+{
+    slong new_alloc;
+
+    if (len <= B->alloc)
+        return;
+
+    new_alloc = FLINT_MAX(len, 2*B->alloc);
+    B->coeffs = (fmpz *) flint_realloc(B->coeffs, new_alloc*sizeof(fmpz));
+    memset(B->coeffs + B->alloc, 0, (new_alloc - B->alloc)*sizeof(fmpz));
+    B->alloc = new_alloc;
+
+    mpoly_exp_builder_realloc(B->exps, new_alloc, ctx->minfo);
+}
+
+void fmpz_mpoly_builder_push_terms_fmpz_ui(fmpz_mpoly_builder_t B,
+                                const fmpz * c, const ulong * exps, slong len,
+                                                    const fmpz_mpoly_ctx_t ctx)
+{
+    slong i, old_length = B->exps->length;
+
+    fmpz_mpoly_builder_fit_length(B, old_length + len, ctx);
+
+    for (i = 0; i < len; i++)
+        fmpz_set(B->coeffs + old_length + i, c + i);
+
+    mpoly_exp_builder_push_ui(B->exps, exps, len, ctx->minfo);
+}
+
+void fmpz_mpoly_builder_push_terms_fmpz_fmpz(fmpz_mpoly_builder_t B,
+                                 const fmpz * c, const fmpz * exps, slong len,
+                                                    const fmpz_mpoly_ctx_t ctx)
+{
+    slong i, old_length = B->exps->length;
+
+    fmpz_mpoly_builder_fit_length(B, old_length + len, ctx);
+
+    for (i = 0; i < len; i++)
+        fmpz_set(B->coeffs + old_length + i, c + i);
+
+    mpoly_exp_builder_push_fmpz(B->exps, exps, len, ctx->minfo);
+}
+
+/*
+    The coefficient array of B is handed over to A as is, and the exponents
+    are packed once into a fresh array at the final bit count. B is left
+    empty and may be reused.
+*/
+void fmpz_mpoly_builder_finish(fmpz_mpoly_t A, fmpz_mpoly_builder_t B,
+                                                    const fmpz_mpoly_ctx_t ctx)
+{
+    slong len = B->exps->length;
+    ulong * exps;
+    mp_bitcnt_t bits;
+
+    bits = mpoly_exp_builder_pack(&exps, B->alloc, B->exps, ctx->minfo);
+
+    fmpz_mpoly_clear(A, ctx);
+    A->coeffs = B->coeffs;
+    A->exps = exps;
+    A->alloc = B->alloc;
+    A->length = len;
+    A->bits = bits;
+
+    B->coeffs = NULL;
+    B->alloc = 0;
+
+    fmpz_mpoly_sort_terms(A, ctx);
+    fmpz_mpoly_combine_like_terms(A, ctx);
+}
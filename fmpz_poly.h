@@ -40,6 +40,7 @@
 #endif
 
 #define FMPZ_POLY_INV_NEWTON_CUTOFF 32
+#define FMPZ_POLY_ADDMUL_CLASSICAL_CUTOFF 7
 #define FMPZ_POLY_SQRT_DIVCONQUER_CUTOFF 16
 #define FMPZ_POLY_SQRTREM_DIVCONQUER_CUTOFF 16
 
@@ -62,6 +63,20 @@ typedef struct
 
 typedef fmpz_poly_powers_precomp_struct fmpz_poly_powers_precomp_t[1];
 
+typedef struct
+{
+   mp_limb_t ** jj; /* forward FFT of poly2, see fft_precache */
+   slong n;
+   slong len1;      /* maximum length and bits of the other operand */
+   slong len2;
+   slong loglen;
+   slong bits1;
+   slong limbs;
+   fmpz_poly_t poly2;
+} fmpz_poly_mul_precache_struct;
+
+typedef fmpz_poly_mul_precache_struct fmpz_poly_mul_precache_t[1];
+
 typedef struct {
     fmpz c;
     fmpz_poly_struct *p;
@@ -463,12 +478,32 @@ FLINT_DLL void _fmpz_poly_mul_SS(fmpz * output, const fmpz * input1, slong lengt
 FLINT_DLL void fmpz_poly_mul_SS(fmpz_poly_t res,
                           const fmpz_poly_t poly1, const fmpz_poly_t poly2);
 
+FLINT_DLL void _fmpz_poly_mul_ntt(fmpz * res, const fmpz * poly1,
+                             slong len1, const fmpz * poly2, slong len2);
+
+FLINT_DLL void fmpz_poly_mul_ntt(fmpz_poly_t res,
+                          const fmpz_poly_t poly1, const fmpz_poly_t poly2);
+
 FLINT_DLL void _fmpz_poly_mullow_SS(fmpz * output, const fmpz * input1, slong length1, 
                                  const fmpz * input2, slong length2, slong n);
 
 FLINT_DLL void fmpz_poly_mullow_SS(fmpz_poly_t res,
                   const fmpz_poly_t poly1, const fmpz_poly_t poly2, slong n);
 
+FLINT_DLL void fmpz_poly_mul_SS_precache_init(fmpz_poly_mul_precache_t pre,
+                           slong len1, slong bits1, const fmpz_poly_t poly2);
+
+FLINT_DLL void fmpz_poly_mul_precache_clear(fmpz_poly_mul_precache_t pre);
+
+FLINT_DLL void _fmpz_poly_mullow_SS_precache(fmpz * output,
+       const fmpz * input1, slong len1, fmpz_poly_mul_precache_t pre, slong trunc);
+
+FLINT_DLL void fmpz_poly_mullow_SS_precache(fmpz_poly_t res,
+            const fmpz_poly_t poly1, fmpz_poly_mul_precache_t pre, slong n);
+
+FLINT_DLL void fmpz_poly_mul_SS_precache(fmpz_poly_t res,
+                       const fmpz_poly_t poly1, fmpz_poly_mul_precache_t pre);
+
 FLINT_DLL void _fmpz_poly_mul(fmpz * res, const fmpz * poly1, 
                                   slong len1, const fmpz * poly2, slong len2);
 
@@ -484,6 +519,12 @@ FLINT_DLL void fmpz_poly_mullow(fmpz_poly_t res,
 FLINT_DLL void fmpz_poly_mulhigh_n(fmpz_poly_t res, 
                   const fmpz_poly_t poly1, const fmpz_poly_t poly2, slong n);
 
+FLINT_DLL void fmpz_poly_addmul(fmpz_poly_t res,
+                          const fmpz_poly_t poly1, const fmpz_poly_t poly2);
+
+FLINT_DLL void fmpz_poly_submul(fmpz_poly_t res,
+                          const fmpz_poly_t poly1, const fmpz_poly_t poly2);
+
 /* Squaring ******************************************************************/
 
 FLINT_DLL void _fmpz_poly_sqr_KS(fmpz * rop, const fmpz * op, slong len);
@@ -1231,6 +1272,9 @@ FLINT_DLL void fmpz_poly_hensel_lift_only_inverse(fmpz_poly_t Aout, fmpz_poly_t
     const fmpz_poly_t a, const fmpz_poly_t b, 
     const fmpz_t p, const fmpz_t p1);
 
+/* combined length above which the subtrees are lifted in parallel */
+#define FMPZ_POLY_HENSEL_LIFT_THREADED_CUTOFF 64
+
 FLINT_DLL void fmpz_poly_hensel_lift_tree_recursive(slong *link, 
     fmpz_poly_t *v, fmpz_poly_t *w, fmpz_poly_t f, slong j, slong inv, 
     const fmpz_t p0, const fmpz_t p1);
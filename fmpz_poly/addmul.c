@@ -0,0 +1,61 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+
+void
+fmpz_poly_addmul(fmpz_poly_t res,
+                   const fmpz_poly_t poly1, const fmpz_poly_t poly2)
+{
+    slong i, len1 = poly1->length, len2 = poly2->length, rlen;
+
+    if (len1 == 0 || len2 == 0)
+        return;
+
+    rlen = len1 + len2 - 1;
+
+    if (FLINT_MIN(len1, len2) < FMPZ_POLY_ADDMUL_CLASSICAL_CUTOFF
+        && res != poly1 && res != poly2)
+    {
+        const fmpz_poly_struct * a = (len1 <= len2) ? poly1 : poly2;
+        const fmpz_poly_struct * b = (len1 <= len2) ? poly2 : poly1;
+
+        /* accumulate straight into res */
+        fmpz_poly_fit_length(res, rlen);
+        if (res->length < rlen)
+            _fmpz_vec_zero(res->coeffs + res->length, rlen - res->length);
+
+        for (i = 0; i < a->length; i++)
+            _fmpz_vec_scalar_addmul_fmpz(res->coeffs + i, b->coeffs,
+                                                 b->length, a->coeffs + i);
+    }
+    else
+    {
+        fmpz * t = _fmpz_vec_init(rlen);
+
+        if (len1 >= len2)
+            _fmpz_poly_mul(t, poly1->coeffs, len1, poly2->coeffs, len2);
+        else
+            _fmpz_poly_mul(t, poly2->coeffs, len2, poly1->coeffs, len1);
+
+        fmpz_poly_fit_length(res, rlen);
+        _fmpz_poly_add(res->coeffs, res->coeffs, res->length, t, rlen);
+
+        _fmpz_vec_clear(t, rlen);
+    }
+
+    _fmpz_poly_set_length(res, FLINT_MAX(res->length, rlen));
+    _fmpz_poly_normalise(res);
+}
@@ -14,6 +14,29 @@
 #include "flint.h"
 #include "fmpz.h"
 #include "fmpz_poly.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+    slong * link;
+    fmpz_poly_t * v;
+    fmpz_poly_t * w;
+    fmpz_poly_struct * f;
+    slong j;
+    slong inv;
+    const fmpz * p0;
+    const fmpz * p1;
+}
+_lift_arg_struct;
+
+static void
+_lift_worker(void * varg)
+{
+    _lift_arg_struct * arg = (_lift_arg_struct *) varg;
+
+    fmpz_poly_hensel_lift_tree_recursive(arg->link, arg->v, arg->w, arg->f,
+        arg->j, arg->inv, arg->p0, arg->p1);
+}
 
 void fmpz_poly_hensel_lift_tree_recursive(slong *link, 
     fmpz_poly_t *v, fmpz_poly_t *w, fmpz_poly_t f, slong j, slong inv, 
@@ -21,6 +44,8 @@ void fmpz_poly_hensel_lift_tree_recursive(slong *link,
 {
     if (j >= 0)
     {
+        thread_pool_handle handle;
+
         if (inv == 1)
             fmpz_poly_hensel_lift(v[j], v[j + 1], w[j], w[j + 1], f, 
                                   v[j], v[j + 1], w[j], w[j + 1], 
@@ -33,10 +58,39 @@ void fmpz_poly_hensel_lift_tree_recursive(slong *link,
                                                   v[j], v[j+1], w[j], w[j+1], 
                                                   p0, p1);
 
-        fmpz_poly_hensel_lift_tree_recursive(link, v, w, v[j], link[j], 
-            inv, p0, p1);
-        fmpz_poly_hensel_lift_tree_recursive(link, v, w, v[j+1], link[j+1], 
-            inv, p0, p1);
+        /*
+            The two subtrees touch disjoint nodes, so the first may be
+            lifted by another thread if both have some work in them.
+        */
+        if (link[j] >= 0 && link[j + 1] >= 0
+            && v[j]->length + v[j + 1]->length
+                                    > FMPZ_POLY_HENSEL_LIFT_THREADED_CUTOFF
+            && global_thread_pool_initialized
+            && thread_pool_request(global_thread_pool, &handle, 1) > 0)
+        {
+            _lift_arg_struct arg;
+
+            arg.link = link;
+            arg.v = v;
+            arg.w = w;
+            arg.f = v[j];
+            arg.j = link[j];
+            arg.inv = inv;
+            arg.p0 = p0;
+            arg.p1 = p1;
+
+            thread_pool_wake(global_thread_pool, handle, _lift_worker, &arg);
+            fmpz_poly_hensel_lift_tree_recursive(link, v, w, v[j+1],
+                link[j+1], inv, p0, p1);
+            thread_pool_wait(global_thread_pool, handle);
+            thread_pool_give_back(global_thread_pool, handle);
+        }
+        else
+        {
+            fmpz_poly_hensel_lift_tree_recursive(link, v, w, v[j], link[j], 
+                inv, p0, p1);
+            fmpz_poly_hensel_lift_tree_recursive(link, v, w, v[j+1], link[j+1], 
+                inv, p0, p1);
+        }
     }
 }
-
@@ -145,6 +145,10 @@ _fmpz_poly_mul(fmpz * res, const fmpz * poly1,
 
     if (len1 < 16 && (limbs1 > 12 || limbs2 > 12))
         _fmpz_poly_mul_karatsuba(res, poly1, len1, poly2, len2);
+    else if (len2 >= FLINT_TUNE_CUTOFF(FLINT_TUNE_FMPZ_POLY_MUL_NTT)
+                          && bits1 + bits2 >= FLINT_BITS
+                          && limbs1 + limbs2 <= 16)
+        _fmpz_poly_mul_ntt(res, poly1, len1, poly2, len2);
     else if (limbs1 + limbs2 <= 8)
         _fmpz_poly_mul_KS(res, poly1, len1, poly2, len2);
     else if ((limbs1+limbs2)/2048 > len1 + len2)
@@ -0,0 +1,30 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include "fmpz_poly.h"
+#include "flint.h"
+
+void
+fmpz_poly_mul_SS_precache(fmpz_poly_t res, const fmpz_poly_t poly1,
+                                          fmpz_poly_mul_precache_t pre)
+{
+    const slong len1 = poly1->length;
+    const slong len2 = pre->len2;
+
+    if (len1 == 0 || len2 == 0)
+    {
+        fmpz_poly_zero(res);
+        return;
+    }
+
+    fmpz_poly_mullow_SS_precache(res, poly1, pre, len1 + len2 - 1);
+}
@@ -0,0 +1,106 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include "fmpz_poly.h"
+#include "fft.h"
+#include "flint.h"
+
+#if HAVE_OPENMP
+#include <omp.h> /* must be after flint.h */
+#endif
+
+void
+fmpz_poly_mul_SS_precache_init(fmpz_poly_mul_precache_t pre,
+                            slong len1, slong bits1, const fmpz_poly_t poly2)
+{
+    slong len2 = poly2->length;
+    slong len_out, loglen, loglen2, n;
+    slong output_bits, limbs, size, i, bits2;
+    mp_limb_t * ptr, ** t1, ** t2, ** s1;
+    int N;
+    TMP_INIT;
+
+    TMP_START;
+
+    len_out = len1 + len2 - 1;
+    loglen  = FLINT_MAX(FLINT_CLOG2(len_out), 2);
+    loglen2 = FLINT_CLOG2(FLINT_MIN(len1, len2));
+    n = (WORD(1) << (loglen - 2));
+
+    bits1 = FLINT_ABS(bits1);
+    bits2 = _fmpz_vec_max_bits(poly2->coeffs, len2);
+    bits2 = FLINT_ABS(bits2);
+
+    /* allow for a sign bit, as the sign of poly1 is not known yet */
+    output_bits = bits1 + bits2 + loglen2 + 1;
+
+    /* round up output bits for sqrt2 */
+    output_bits = (((output_bits - 1) >> (loglen - 2)) + 1) << (loglen - 2);
+
+    limbs = (output_bits - 1) / FLINT_BITS + 1;
+    limbs = fft_adjust_limbs(limbs); /* round up limbs for Nussbaumer */
+    size = limbs + 1;
+
+#if HAVE_OPENMP
+    N = omp_get_max_threads();
+#else
+    N = 1;
+#endif
+
+    /*
+       The transform swaps coefficient pointers with the temporaries, so
+       these are allocated in the same block as the coefficients.
+    */
+    pre->jj = flint_malloc((4*(n + n*size) + 3*size*N)*sizeof(mp_limb_t));
+    for (i = 0, ptr = (mp_limb_t *) pre->jj + 4*n; i < 4*n; i++, ptr += size)
+        pre->jj[i] = ptr;
+
+    t1 = TMP_ALLOC(N*sizeof(mp_limb_t *));
+    t2 = TMP_ALLOC(N*sizeof(mp_limb_t *));
+    s1 = TMP_ALLOC(N*sizeof(mp_limb_t *));
+
+    t1[0] = ptr;
+    t2[0] = t1[0] + size*N;
+    s1[0] = t2[0] + size*N;
+
+    for (i = 1; i < N; i++)
+    {
+        t1[i] = t1[i - 1] + size;
+        t2[i] = t2[i - 1] + size;
+        s1[i] = s1[i - 1] + size;
+    }
+
+    _fmpz_vec_get_fft(pre->jj, poly2->coeffs, limbs, len2);
+    for (i = len2; i < 4*n; i++)
+        flint_mpn_zero(pre->jj[i], size);
+
+    fft_precache(pre->jj, loglen - 2, limbs, len_out, t1, t2, s1);
+
+    pre->n = n;
+    pre->len1 = len1;
+    pre->len2 = len2;
+    pre->loglen = loglen;
+    pre->bits1 = bits1;
+    pre->limbs = limbs;
+
+    fmpz_poly_init(pre->poly2);
+    fmpz_poly_set(pre->poly2, poly2);
+
+    TMP_END;
+}
+
+void
+fmpz_poly_mul_precache_clear(fmpz_poly_mul_precache_t pre)
+{
+    flint_free(pre->jj);
+    fmpz_poly_clear(pre->poly2);
+}
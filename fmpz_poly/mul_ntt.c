@@ -0,0 +1,314 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "nmod_poly.h"
+#include "thread_pool.h"
+
+/* residues modulo an NTT prime p; note |c| < 2p for small c */
+static void
+_fmpz_vec_get_ntt_residues(mp_ptr res, const fmpz * vec, slong len,
+                                                                mp_limb_t p)
+{
+    slong i;
+    mp_limb_t x;
+
+    for (i = 0; i < len; i++)
+    {
+        fmpz c = vec[i];
+
+        if (!COEFF_IS_MPZ(c))
+        {
+            x = FLINT_ABS(c);
+            if (x >= p)
+                x -= p;
+            if (c < 0 && x != 0)
+                x = p - x;
+        }
+        else
+        {
+            __mpz_struct * m = COEFF_TO_PTR(c);
+            x = mpn_mod_1(m->_mp_d, FLINT_ABS(m->_mp_size), p);
+            if (m->_mp_size < 0 && x != 0)
+                x = p - x;
+        }
+
+        res[i] = x;
+    }
+}
+
+typedef struct
+{
+    fmpz * res;
+    const fmpz * poly1;
+    slong len1;
+    const fmpz * poly2;
+    slong len2;
+    mp_ptr r;         /* residues of the product, one row per prime */
+    slong num_primes;
+    mp_srcptr P;      /* product of the primes, Pn limbs */
+    mp_srcptr Phalf;  /* floor(P/2) */
+    mp_srcptr M;      /* P/p_j, Pn limbs each */
+    mp_srcptr c;      /* (P/p_j)^-1 mod p_j and its Shoup quotient */
+    mp_srcptr c_pre;
+    slong Pn;
+    slong start;      /* primes [start, stop) when reducing, */
+    slong stop;
+    slong cstart;     /* coefficients [cstart, cstop) when reconstructing */
+    slong cstop;
+    int crt;
+}
+_mul_ntt_worker_arg_struct;
+
+static void
+_fmpz_poly_mul_ntt_worker(void * varg)
+{
+    _mul_ntt_worker_arg_struct * arg = (_mul_ntt_worker_arg_struct *) varg;
+    const slong len1 = arg->len1, len2 = arg->len2;
+    const slong rlen = len1 + len2 - 1;
+    const int squaring = (arg->poly1 == arg->poly2 && len1 == len2);
+    slong i, j;
+
+    if (arg->crt)
+    {
+        const slong Pn = arg->Pn;
+        mp_limb_t p, t, q[2];
+        mp_ptr acc, x;
+
+        acc = (mp_ptr) flint_malloc((2*Pn + 1)*sizeof(mp_limb_t));
+        x = acc + Pn + 1;
+
+        /* x = sum_j ((r_j c_j) mod p_j) P/p_j mod P, then symmetric lift */
+        for (i = arg->cstart; i < arg->cstop; i++)
+        {
+            flint_mpn_zero(acc, Pn + 1);
+
+            for (j = 0; j < arg->num_primes; j++)
+            {
+                p = _nmod_poly_ntt_primes[j];
+                t = n_mulmod_shoup(arg->c[j], arg->r[j*rlen + i],
+                                                         arg->c_pre[j], p);
+                acc[Pn] += mpn_addmul_1(acc, arg->M + j*Pn, Pn, t);
+            }
+
+            mpn_tdiv_qr(q, x, 0, acc, Pn + 1, arg->P, Pn);
+
+            if (mpn_cmp(x, arg->Phalf, Pn) > 0)
+            {
+                mpn_sub_n(x, arg->P, x, Pn);
+                fmpz_set_ui_array(arg->res + i, x, Pn);
+                fmpz_neg(arg->res + i, arg->res + i);
+            }
+            else
+                fmpz_set_ui_array(arg->res + i, x, Pn);
+        }
+
+        flint_free(acc);
+    }
+    else
+    {
+        mp_ptr t1, t2;
+        mp_limb_t p;
+
+        t1 = (mp_ptr) flint_malloc((len1 + len2)*sizeof(mp_limb_t));
+        t2 = squaring ? t1 : t1 + len1;
+
+        for (j = arg->start; j < arg->stop; j++)
+        {
+            p = _nmod_poly_ntt_primes[j];
+            _fmpz_vec_get_ntt_residues(t1, arg->poly1, len1, p);
+            if (!squaring)
+                _fmpz_vec_get_ntt_residues(t2, arg->poly2, len2, p);
+
+            _nmod_poly_mul_ntt_prime(arg->r + j*rlen, t1, len1, t2, len2, j);
+        }
+
+        flint_free(t1);
+    }
+}
+
+void
+_fmpz_poly_mul_ntt(fmpz * res, const fmpz * poly1, slong len1,
+                                            const fmpz * poly2, slong len2)
+{
+    const slong rlen = len1 + len2 - 1;
+    slong i, j, bits1, bits2, num_primes, num_workers, num_threads, Pn;
+    mp_bitcnt_t bits;
+    mp_limb_t p;
+    mp_ptr r, P, Phalf, M, c, c_pre;
+    thread_pool_handle * handles;
+    _mul_ntt_worker_arg_struct * args;
+
+    bits1 = _fmpz_vec_max_bits(poly1, len1);
+    bits2 = (poly1 == poly2) ? bits1 : _fmpz_vec_max_bits(poly2, len2);
+    bits1 = FLINT_ABS(bits1);
+    bits2 = FLINT_ABS(bits2);
+
+    if (bits1 == 0 || bits2 == 0)
+    {
+        _fmpz_vec_zero(res, rlen);
+        return;
+    }
+
+    /* coefficients of the product are bounded by len2*2^(bits1 + bits2) */
+    bits = bits1 + bits2 + FLINT_BIT_COUNT(len2) + 1;
+    num_primes = (bits + NMOD_POLY_NTT_PRIME_BITS - 1)/NMOD_POLY_NTT_PRIME_BITS;
+
+    if (num_primes > NMOD_POLY_NTT_NUM_PRIMES
+                           || FLINT_CLOG2(rlen) > NMOD_POLY_NTT_MAX_DEPTH)
+    {
+        if (len2 <= 2)
+            _fmpz_poly_mul_classical(res, poly1, len1, poly2, len2);
+        else
+            _fmpz_poly_mul_SS(res, poly1, len1, poly2, len2);
+        return;
+    }
+
+    /* CRT data: P, P/2, M_j = P/p_j and c_j = M_j^-1 mod p_j */
+    P = (mp_ptr) flint_malloc((num_primes*(num_primes + 4) + 2)
+                                                       *sizeof(mp_limb_t));
+    Phalf = P + num_primes + 1;
+    c = Phalf + num_primes + 1;
+    c_pre = c + num_primes;
+    M = c_pre + num_primes;
+
+    P[0] = _nmod_poly_ntt_primes[0];
+    Pn = 1;
+    for (j = 1; j < num_primes; j++)
+    {
+        P[Pn] = mpn_mul_1(P, P, Pn, _nmod_poly_ntt_primes[j]);
+        Pn += (P[Pn] != 0);
+    }
+
+    mpn_rshift(Phalf, P, Pn, 1);
+
+    for (j = 0; j < num_primes; j++)
+    {
+        p = _nmod_poly_ntt_primes[j];
+        mpn_divrem_1(M + j*Pn, 0, P, Pn, p);
+        c[j] = n_invmod(mpn_mod_1(M + j*Pn, Pn, p), p);
+        c_pre[j] = n_mulmod_precomp_shoup(c[j], p);
+    }
+
+    r = (mp_ptr) flint_malloc(num_primes*rlen*sizeof(mp_limb_t));
+
+    num_workers = 0;
+    handles = NULL;
+    if (global_thread_pool_initialized && num_primes > 1 && rlen > 1000)
+    {
+        handles = (thread_pool_handle *) flint_malloc((num_primes - 1)
+                                                 *sizeof(thread_pool_handle));
+        num_workers = thread_pool_request(global_thread_pool,
+                                                   handles, num_primes - 1);
+    }
+
+    num_threads = num_workers + 1;
+    args = (_mul_ntt_worker_arg_struct *) flint_malloc(num_threads
+                                         *sizeof(_mul_ntt_worker_arg_struct));
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].res = res;
+        args[i].poly1 = poly1;
+        args[i].len1 = len1;
+        args[i].poly2 = poly2;
+        args[i].len2 = len2;
+        args[i].r = r;
+        args[i].num_primes = num_primes;
+        args[i].P = P;
+        args[i].Phalf = Phalf;
+        args[i].M = M;
+        args[i].c = c;
+        args[i].c_pre = c_pre;
+        args[i].Pn = Pn;
+        args[i].start = (num_primes*i)/num_threads;
+        args[i].stop = (num_primes*(i + 1))/num_threads;
+        args[i].cstart = (rlen*i)/num_threads;
+        args[i].cstop = (rlen*(i + 1))/num_threads;
+        args[i].crt = 0;
+    }
+
+    /* convolutions modulo each prime, then reconstruction */
+    while (1)
+    {
+        for (i = 0; i < num_workers; i++)
+            thread_pool_wake(global_thread_pool, handles[i],
+                                     _fmpz_poly_mul_ntt_worker, &args[i + 1]);
+
+        _fmpz_poly_mul_ntt_worker(&args[0]);
+
+        for (i = 0; i < num_workers; i++)
+            thread_pool_wait(global_thread_pool, handles[i]);
+
+        if (args[0].crt)
+            break;
+
+        for (i = 0; i < num_threads; i++)
+            args[i].crt = 1;
+    }
+
+    for (i = 0; i < num_workers; i++)
+        thread_pool_give_back(global_thread_pool, handles[i]);
+
+    flint_free(args);
+    if (handles != NULL)
+        flint_free(handles);
+
+    flint_free(r);
+    flint_free(P);
+}
+
+void
+fmpz_poly_mul_ntt(fmpz_poly_t res,
+                          const fmpz_poly_t poly1, const fmpz_poly_t poly2)
+{
+    const slong len1 = poly1->length;
+    const slong len2 = poly2->length;
+    slong rlen;
+
+    if (len1 == 0 || len2 == 0)
+    {
+        fmpz_poly_zero(res);
+        return;
+    }
+
+    rlen = len1 + len2 - 1;
+
+    if (res == poly1 || res == poly2)
+    {
+        fmpz_poly_t t;
+        fmpz_poly_init2(t, rlen);
+        if (len1 >= len2)
+            _fmpz_poly_mul_ntt(t->coeffs, poly1->coeffs, len1,
+                                          poly2->coeffs, len2);
+        else
+            _fmpz_poly_mul_ntt(t->coeffs, poly2->coeffs, len2,
+                                          poly1->coeffs, len1);
+        fmpz_poly_swap(res, t);
+        fmpz_poly_clear(t);
+    }
+    else
+    {
+        fmpz_poly_fit_length(res, rlen);
+        if (len1 >= len2)
+            _fmpz_poly_mul_ntt(res->coeffs, poly1->coeffs, len1,
+                                            poly2->coeffs, len2);
+        else
+            _fmpz_poly_mul_ntt(res->coeffs, poly2->coeffs, len2,
+                                            poly1->coeffs, len1);
+    }
+
+    _fmpz_poly_set_length(res, rlen);
+}
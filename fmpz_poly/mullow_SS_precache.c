@@ -0,0 +1,127 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include "fmpz_poly.h"
+#include "fft.h"
+#include "flint.h"
+
+#if HAVE_OPENMP
+#include <omp.h> /* must be after flint.h */
+#endif
+
+void _fmpz_poly_mullow_SS_precache(fmpz * output, const fmpz * input1,
+                    slong len1, fmpz_poly_mul_precache_t pre, slong trunc)
+{
+    const slong len2 = pre->len2;
+    slong n, limbs, size, i, bits1;
+    mp_limb_t * ptr, ** t1, ** t2, ** tt, ** s1, ** ii;
+    int N;
+    TMP_INIT;
+
+    len1 = FLINT_MIN(len1, trunc);
+
+    bits1 = _fmpz_vec_max_bits(input1, len1);
+    bits1 = FLINT_ABS(bits1);
+
+    /* input too large for the precomputed transform */
+    if (len1 > pre->len1 || bits1 > pre->bits1)
+    {
+        if (len1 >= len2)
+            _fmpz_poly_mullow(output, input1, len1,
+                                       pre->poly2->coeffs, len2, trunc);
+        else
+            _fmpz_poly_mullow(output, pre->poly2->coeffs, len2,
+                                                   input1, len1, trunc);
+        return;
+    }
+
+    TMP_START;
+
+    n = pre->n;
+    limbs = pre->limbs;
+    size = limbs + 1;
+
+#if HAVE_OPENMP
+    N = omp_get_max_threads();
+#else
+    N = 1;
+#endif
+
+    ii = flint_malloc((4*(n + n*size) + 5*size*N)*sizeof(mp_limb_t));
+    for (i = 0, ptr = (mp_limb_t *) ii + 4*n; i < 4*n; i++, ptr += size) 
+        ii[i] = ptr;
+
+    t1 = TMP_ALLOC(N*sizeof(mp_limb_t *));
+    t2 = TMP_ALLOC(N*sizeof(mp_limb_t *));
+    s1 = TMP_ALLOC(N*sizeof(mp_limb_t *));
+    tt = TMP_ALLOC(N*sizeof(mp_limb_t *));
+
+    t1[0] = ptr;
+    t2[0] = t1[0] + size*N;
+    s1[0] = t2[0] + size*N;
+    tt[0] = s1[0] + size*N;
+
+    for (i = 1; i < N; i++)
+    {
+        t1[i] = t1[i - 1] + size;
+        t2[i] = t2[i - 1] + size;
+        s1[i] = s1[i - 1] + size;
+        tt[i] = tt[i - 1] + 2*size;
+    }
+
+    /* put coefficients into FFT vecs */
+    _fmpz_vec_get_fft(ii, input1, limbs, len1);
+    for (i = len1; i < 4*n; i++)
+        flint_mpn_zero(ii[i], size);
+
+    fft_convolution_precache(ii, pre->jj, pre->loglen - 2, limbs,
+                                 pre->len1 + len2 - 1, t1, t2, s1, tt);
+
+    _fmpz_vec_set_fft(output, trunc, ii, limbs, 1); /* write output */
+
+    flint_free(ii);
+
+    TMP_END;
+}
+
+void
+fmpz_poly_mullow_SS_precache(fmpz_poly_t res, const fmpz_poly_t poly1,
+                                     fmpz_poly_mul_precache_t pre, slong n)
+{
+    const slong len1 = poly1->length;
+    const slong len2 = pre->len2;
+
+    if (len1 == 0 || len2 == 0 || n == 0)
+    {
+        fmpz_poly_zero(res);
+        return;
+    }
+
+    n = FLINT_MIN(n, len1 + len2 - 1);
+
+    if (res == poly1)
+    {
+        fmpz_poly_t t;
+        fmpz_poly_init2(t, n);
+        _fmpz_poly_mullow_SS_precache(t->coeffs, poly1->coeffs, len1, pre, n);
+        fmpz_poly_swap(res, t);
+        fmpz_poly_clear(t);
+    }
+    else
+    {
+        fmpz_poly_fit_length(res, n);
+        _fmpz_poly_mullow_SS_precache(res->coeffs, poly1->coeffs, len1, pre, n);
+    }
+
+    _fmpz_poly_set_length(res, n);
+    _fmpz_poly_normalise(res);
+}
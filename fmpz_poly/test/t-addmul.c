@@ -0,0 +1,153 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("addmul/submul....");
+    fflush(stdout);
+
+    /* Compare with mul followed by add or sub */
+    for (i = 0; i < 2000 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, b, c, d, t;
+        int sub = n_randint(state, 2);
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+        fmpz_poly_init(c);
+        fmpz_poly_init(d);
+        fmpz_poly_init(t);
+
+        /* short factors use the direct accumulation */
+        fmpz_poly_randtest(b, state, n_randint(state,
+                                  n_randint(state, 2) ? 10 : 60), 200);
+        fmpz_poly_randtest(c, state, n_randint(state, 60), 200);
+        fmpz_poly_randtest(a, state, n_randint(state, 100), 200);
+
+        /* leave junk beyond the length of a */
+        fmpz_poly_truncate(a, n_randint(state, 100));
+
+        /* cancellation of the leading terms */
+        if (n_randint(state, 4) == 0)
+        {
+            fmpz_poly_mul(a, b, c);
+            if (!sub)
+                fmpz_poly_neg(a, a);
+        }
+
+        fmpz_poly_mul(t, b, c);
+        if (sub)
+        {
+            fmpz_poly_sub(d, a, t);
+            fmpz_poly_submul(a, b, c);
+        }
+        else
+        {
+            fmpz_poly_add(d, a, t);
+            fmpz_poly_addmul(a, b, c);
+        }
+
+        result = (fmpz_poly_equal(a, d) && (a->length == 0 ||
+                                !fmpz_is_zero(a->coeffs + a->length - 1)));
+        if (!result)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("sub = %d\n", sub);
+            fmpz_poly_print(a), flint_printf("\n\n");
+            fmpz_poly_print(d), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+        fmpz_poly_clear(c);
+        fmpz_poly_clear(d);
+        fmpz_poly_clear(t);
+    }
+
+    /* Check aliasing of res with the factors */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, b, d, t;
+        int sub = n_randint(state, 2);
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+        fmpz_poly_init(d);
+        fmpz_poly_init(t);
+
+        fmpz_poly_randtest(a, state, n_randint(state, 30), 200);
+        fmpz_poly_randtest(b, state, n_randint(state, 30), 200);
+
+        switch (n_randint(state, 3))
+        {
+            case 0:
+                fmpz_poly_mul(t, a, b);
+                break;
+            case 1:
+                fmpz_poly_mul(t, b, a);
+                fmpz_poly_swap(a, b);
+                break;
+            default:
+                fmpz_poly_mul(t, a, a);
+                fmpz_poly_set(b, a);
+        }
+
+        if (sub)
+        {
+            fmpz_poly_sub(d, a, t);
+            if (fmpz_poly_equal(a, b))
+                fmpz_poly_submul(a, a, a);
+            else
+                fmpz_poly_submul(a, a, b);
+        }
+        else
+        {
+            fmpz_poly_add(d, a, t);
+            if (fmpz_poly_equal(a, b))
+                fmpz_poly_addmul(a, a, a);
+            else
+                fmpz_poly_addmul(a, b, a);
+        }
+
+        result = (fmpz_poly_equal(a, d));
+        if (!result)
+        {
+            flint_printf("FAIL (aliasing):\n");
+            flint_printf("sub = %d\n", sub);
+            fmpz_poly_print(a), flint_printf("\n\n");
+            fmpz_poly_print(d), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+        fmpz_poly_clear(d);
+        fmpz_poly_clear(t);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
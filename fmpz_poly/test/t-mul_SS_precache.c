@@ -0,0 +1,123 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_SS_precache....");
+    fflush(stdout);
+
+    /* Compare with mul_KS, several products per precomputation */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, b, c, d;
+        fmpz_poly_mul_precache_t pre;
+        slong j, len1, bits1, len2, bits2;
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+        fmpz_poly_init(c);
+        fmpz_poly_init(d);
+
+        len1 = n_randint(state, 300) + 2;
+        bits1 = n_randint(state, 500) + 1;
+        len2 = n_randint(state, 300) + 2;
+        bits2 = n_randint(state, 500) + 1;
+
+        do {
+            fmpz_poly_randtest(c, state, len2, bits2);
+        } while (c->length < 2);
+
+        fmpz_poly_mul_SS_precache_init(pre, len1, bits1, c);
+
+        for (j = 0; j < 4; j++)
+        {
+            /* sometimes exceed the precomputed length or size */
+            fmpz_poly_randtest(b, state, n_randint(state, len1 + 10),
+                                         n_randint(state, bits1 + 10) + 1);
+
+            fmpz_poly_mul_SS_precache(a, b, pre);
+            fmpz_poly_mul_KS(d, b, c);
+
+            result = (fmpz_poly_equal(a, d));
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("len1 = %wd, bits1 = %wd\n", len1, bits1);
+                fmpz_poly_print(a), flint_printf("\n\n");
+                fmpz_poly_print(d), flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        fmpz_poly_mul_precache_clear(pre);
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+        fmpz_poly_clear(c);
+        fmpz_poly_clear(d);
+    }
+
+    /* Compare mullow with mullow_KS, aliasing the output */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t a, b, c;
+        fmpz_poly_mul_precache_t pre;
+        slong trunc;
+
+        fmpz_poly_init(a);
+        fmpz_poly_init(b);
+        fmpz_poly_init(c);
+
+        fmpz_poly_randtest(b, state, n_randint(state, 300) + 1,
+                                     n_randint(state, 300) + 1);
+        do {
+            fmpz_poly_randtest(c, state, n_randint(state, 300) + 2,
+                                         n_randint(state, 300) + 1);
+        } while (c->length < 2);
+        trunc = n_randint(state, 600) + 1;
+
+        fmpz_poly_mul_SS_precache_init(pre, b->length + 1,
+                                      FLINT_ABS(fmpz_poly_max_bits(b)), c);
+
+        fmpz_poly_mullow_KS(a, b, c, trunc);
+        fmpz_poly_mullow_SS_precache(b, b, pre, trunc);
+
+        result = (fmpz_poly_equal(a, b));
+        if (!result)
+        {
+            flint_printf("FAIL (mullow):\n");
+            fmpz_poly_print(a), flint_printf("\n\n");
+            fmpz_poly_print(b), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_mul_precache_clear(pre);
+        fmpz_poly_clear(a);
+        fmpz_poly_clear(b);
+        fmpz_poly_clear(c);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
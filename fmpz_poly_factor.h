@@ -67,6 +67,9 @@ FLINT_DLL void fmpz_poly_factor_squarefree(fmpz_poly_factor_t fac,
 
 FLINT_DLL void fmpz_poly_factor_mignotte(fmpz_t B, const fmpz_poly_t f);
 
+/* least number of primes tried by _fmpz_poly_factor_zassenhaus */
+#define FMPZ_POLY_FACTOR_ZASSENHAUS_PRIMES 3
+
 FLINT_DLL void _fmpz_poly_factor_zassenhaus(fmpz_poly_factor_t final_fac, 
               slong exp, const fmpz_poly_t f, slong cutoff, int use_van_hoeij);
 
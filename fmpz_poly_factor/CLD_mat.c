@@ -10,6 +10,7 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
+#include <pthread.h>
 #include <gmp.h>
 #include <stdlib.h>
 #include "flint.h"
@@ -18,6 +19,101 @@
 #include "fmpz_mat.h"
 
 #include "fmpz_mod_poly.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+   pthread_mutex_t mutex;
+   slong next;
+   fmpz_mat_struct * res;
+   const fmpz_poly_struct * f;
+   const fmpz_poly_struct * fac;
+   const fmpz * P;
+   slong r;
+   slong lo_n;
+   slong hi_n;
+}
+_CLD_mat_arg_struct;
+
+/*
+   Each thread repeatedly takes the next task: tasks i < r compute the
+   bottom lo_n coefficients for the local factor i, tasks r + i the top
+   hi_n coefficients.
+*/
+static void
+_CLD_mat_worker(void * varg)
+{
+   _CLD_mat_arg_struct * arg = (_CLD_mat_arg_struct *) varg;
+   fmpz_mat_struct * res = arg->res;
+   const fmpz_poly_struct * f = arg->f;
+   slong i, zeroes, r = arg->r, lo_n = arg->lo_n, hi_n = arg->hi_n;
+   fmpz_poly_t gd, gcld, temp;
+   fmpz_poly_t trunc_f, trunc_fac; /* don't initialise trunc_f, trunc_fac */
+   const fmpz * P = arg->P;
+
+   fmpz_poly_init(gd);
+   fmpz_poly_init(gcld);
+   fmpz_poly_init(temp);
+   /* do not initialise trunc_f */
+   /* do not initialise trunc_fac */
+
+   if (hi_n > 0)
+      fmpz_poly_attach_shift(trunc_f, f, f->length - hi_n);
+
+   while (1)
+   {
+      pthread_mutex_lock(&arg->mutex);
+      i = arg->next++;
+      pthread_mutex_unlock(&arg->mutex);
+
+      if (i >= 2*r)
+         break;
+
+      if (i < r)
+      {
+         if (lo_n == 0)
+            continue;
+
+         zeroes = 0;
+         while (fmpz_is_zero(arg->fac[i].coeffs + zeroes))
+            zeroes++;
+
+         fmpz_poly_attach_truncate(trunc_fac, arg->fac + i, lo_n + zeroes + 1);
+         fmpz_poly_derivative(gd, trunc_fac);
+         fmpz_poly_mullow(gcld, f, gd, lo_n + zeroes);
+         fmpz_poly_divlow_smodp(res->rows[i], gcld, trunc_fac, P, lo_n);
+      } else
+      {
+         slong len;
+
+         if (hi_n == 0)
+            continue;
+
+         i -= r;
+         len = arg->fac[i].length - hi_n - 1;
+
+         if (len < 0)
+         {
+            fmpz_poly_shift_left(temp, arg->fac + i, -len);
+            fmpz_poly_derivative(gd, temp);
+            fmpz_poly_mulhigh_n(gcld, trunc_f, gd, hi_n);
+            fmpz_poly_divhigh_smodp(res->rows[i] + lo_n, gcld, temp, P, hi_n);
+         } else
+         {
+            fmpz_poly_attach_shift(trunc_fac, arg->fac + i, len);
+            fmpz_poly_derivative(gd, trunc_fac);
+            fmpz_poly_mulhigh_n(gcld, trunc_f, gd, hi_n);
+            fmpz_poly_divhigh_smodp(res->rows[i] + lo_n, gcld, trunc_fac, P, hi_n);
+         }
+      }
+   }
+
+   /* do not clear trunc_fac */
+   /* do not clear trunc_f */
+   fmpz_poly_clear(gd);
+   fmpz_poly_clear(gcld);
+   fmpz_poly_clear(temp);
+}
 
 slong _fmpz_poly_factor_CLD_mat(fmpz_mat_t res, const fmpz_poly_t f,
                               fmpz_poly_factor_t lifted_fac, fmpz_t P, ulong k)
@@ -30,11 +126,10 @@ slong _fmpz_poly_factor_CLD_mat(fmpz_mat_t res, const fmpz_poly_t f,
       initialised to be of size (r + 1, 2k).
    */
 
-   slong i, zeroes, bound, lo_n, hi_n, r = lifted_fac->num;
+   slong i, bound, lo_n, hi_n, r = lifted_fac->num;
    slong bit_r = FLINT_MAX(r, 20);
-   fmpz_poly_t gd, gcld, temp;
-   fmpz_poly_t trunc_f, trunc_fac; /* don't initialise trunc_f, trunc_fac */
    fmpz_t t;
+   _CLD_mat_arg_struct arg[1];
 
    /* insert CLD bounds in last row of matrix */
 
@@ -70,54 +165,52 @@ slong _fmpz_poly_factor_CLD_mat(fmpz_mat_t res, const fmpz_poly_t f,
 
    fmpz_clear(t);
 
-   /* now insert data into matrix */
+   /* now insert data into matrix, one local factor per task */
 
-   fmpz_poly_init(gd);
-   fmpz_poly_init(gcld);
-   /* do not initialise trunc_f */
-   /* do not initialise trunc_fac */
-
-   if (lo_n > 0)
+   if (lo_n > 0 || hi_n > 0)
    {
-      for (i = 0; i < r; i++)
+      pthread_mutex_init(&arg->mutex, NULL);
+      arg->next = 0;
+      arg->res = res;
+      arg->f = f;
+      arg->fac = lifted_fac->p;
+      arg->P = P;
+      arg->r = r;
+      arg->lo_n = lo_n;
+      arg->hi_n = hi_n;
+
+      if (global_thread_pool_initialized && r > 1)
       {
-         zeroes = 0;
-         while (lifted_fac->p[i].coeffs + zeroes)
-            zeroes++;
+         slong num_workers;
+         thread_pool_handle * handles;
 
-         fmpz_poly_attach_truncate(trunc_fac, lifted_fac->p + i, lo_n + zeroes + 1);
-         fmpz_poly_derivative(gd, trunc_fac);
-         fmpz_poly_mullow(gcld, f, gd, lo_n + zeroes);
-         fmpz_poly_divlow_smodp(res->rows[i], gcld, trunc_fac, P, lo_n);
-      }      
-   }
+         num_workers = thread_pool_get_size(global_thread_pool);
+         num_workers = FLINT_MIN(num_workers, r - 1);
+         handles = (thread_pool_handle *) flint_malloc(
+                           FLINT_MAX(num_workers, 1)*sizeof(thread_pool_handle));
+         num_workers = thread_pool_request(global_thread_pool,
+                                                         handles, num_workers);
 
-   if (hi_n > 0)
-   {
-      fmpz_poly_init(temp);
+         for (i = 0; i < num_workers; i++)
+            thread_pool_wake(global_thread_pool, handles[i],
+                                                         _CLD_mat_worker, arg);
 
-      fmpz_poly_attach_shift(trunc_f, f, f->length - hi_n);
-      
-      for (i = 0; i < r; i++)
-      {
-         slong len = lifted_fac->p[i].length - hi_n - 1;
+         _CLD_mat_worker(arg);
 
-         if (len < 0)
+         for (i = 0; i < num_workers; i++)
          {
-            fmpz_poly_shift_left(temp, lifted_fac->p + i, -len);
-            fmpz_poly_derivative(gd, temp);
-            fmpz_poly_mulhigh_n(gcld, trunc_f, gd, hi_n);
-            fmpz_poly_divhigh_smodp(res->rows[i] + lo_n, gcld, temp, P, hi_n);
-         } else
-         {
-            fmpz_poly_attach_shift(trunc_fac, lifted_fac->p + i, len);
-            fmpz_poly_derivative(gd, trunc_fac);
-            fmpz_poly_mulhigh_n(gcld, trunc_f, gd, hi_n);
-            fmpz_poly_divhigh_smodp(res->rows[i] + lo_n, gcld, trunc_fac, P, hi_n);
+            thread_pool_wait(global_thread_pool, handles[i]);
+            thread_pool_give_back(global_thread_pool, handles[i]);
          }
+
+         flint_free(handles);
+      }
+      else
+      {
+         _CLD_mat_worker(arg);
       }
 
-      fmpz_poly_clear(temp);      
+      pthread_mutex_destroy(&arg->mutex);
    }
 
    if (hi_n > 0)
@@ -127,11 +220,5 @@ slong _fmpz_poly_factor_CLD_mat(fmpz_mat_t res, const fmpz_poly_t f,
          fmpz_set(res->rows[r] + lo_n + i, res->rows[r] + 2*k - hi_n + i);
    }
 
-   /* do not clear trunc_fac */
-   /* do not clear trunc_f */
-   fmpz_poly_clear(gd);
-   fmpz_poly_clear(gcld);
-
    return lo_n + hi_n;
 }
-
@@ -11,10 +11,41 @@
 */
 
 #include <stdlib.h>
+#include "thread_pool.h"
 #include "fmpz_poly.h"
 
 #define TRACE_ZASSENHAUS 0
 
+typedef struct
+{
+    pthread_mutex_t mutex;
+    slong next;
+    slong num;
+    nmod_poly_struct * t;
+    nmod_poly_factor_struct * fac;
+}
+_zassenhaus_prime_struct;
+
+/* Each thread repeatedly takes the next candidate prime. */
+static void
+_zassenhaus_prime_worker(void * varg)
+{
+    _zassenhaus_prime_struct * S = (_zassenhaus_prime_struct *) varg;
+    slong i;
+
+    while (1)
+    {
+        pthread_mutex_lock(&S->mutex);
+        i = S->next++;
+        pthread_mutex_unlock(&S->mutex);
+
+        if (i >= S->num)
+            return;
+
+        nmod_poly_factor(S->fac + i, S->t + i);
+    }
+}
+
 /*
     Let $f$ be a polynomial of degree $m = \deg(f) \geq 2$. 
     If another polynomial $g$ divides $f$ then, for all 
@@ -103,56 +134,101 @@ void _fmpz_poly_factor_zassenhaus(fmpz_poly_factor_t final_fac,
     }
     else
     {
-        slong i;
+        slong i, num_cand, num_workers = 0;
         slong r = lenF;
         mp_limb_t p = 2;
-        nmod_poly_t d, g, t;
+        nmod_poly_t d, g;
+        nmod_poly_struct * t;
+        nmod_poly_factor_struct * cand_fac;
+        thread_pool_handle * handles = NULL;
         nmod_poly_factor_t fac;
+        _zassenhaus_prime_struct S[1];
 
         nmod_poly_factor_init(fac);
-        nmod_poly_init_preinv(t, 1, 0);
+
+        /*
+            Take as many candidate primes as there are threads to factor
+            modulo them, but at least FMPZ_POLY_FACTOR_ZASSENHAUS_PRIMES.
+        */
+        if (global_thread_pool_initialized)
+        {
+            slong max_workers = thread_pool_get_size(global_thread_pool);
+            if (max_workers > 0)
+            {
+                handles = flint_malloc(max_workers*sizeof(thread_pool_handle));
+                num_workers = thread_pool_request(global_thread_pool,
+                                                        handles, max_workers);
+            }
+        }
+        num_cand = FLINT_MAX(FMPZ_POLY_FACTOR_ZASSENHAUS_PRIMES,
+                                                              num_workers + 1);
+
+        t = flint_malloc(num_cand*sizeof(nmod_poly_struct));
+        cand_fac = flint_malloc(num_cand*sizeof(nmod_poly_factor_struct));
         nmod_poly_init_preinv(d, 1, 0);
         nmod_poly_init_preinv(g, 1, 0);
 
-        for (i = 0; i < 3; i++)
+        for (i = 0; i < num_cand; i++)
         {
             for ( ; ; p = n_nextprime(p, 0))
             {
-                nmod_t mod;
+                nmod_init(&d->mod, p);
+                g->mod = d->mod;
+                nmod_poly_init_preinv(t + i, p, d->mod.ninv);
 
-                nmod_init(&mod, p);
-                d->mod = mod;
-                g->mod = mod;
-                t->mod = mod;
-
-                fmpz_poly_get_nmod_poly(t, f);
-                if (t->length == lenF && t->coeffs[0] != 0)
+                fmpz_poly_get_nmod_poly(t + i, f);
+                if (t[i].length == lenF && t[i].coeffs[0] != 0)
                 {
-                    nmod_poly_derivative(d, t);
-                    nmod_poly_gcd(g, t, d);
+                    nmod_poly_derivative(d, t + i);
+                    nmod_poly_gcd(g, t + i, d);
 
                     if (nmod_poly_is_one(g))
-                    {
-                        nmod_poly_factor_t temp_fac;
-
-                        nmod_poly_factor_init(temp_fac);
-                        nmod_poly_factor(temp_fac, t);
-
-                        if (temp_fac->num <= r)
-                        {
-                            r = temp_fac->num;
-                            nmod_poly_factor_set(fac, temp_fac);
-                        }
-                        nmod_poly_factor_clear(temp_fac);
                         break;
-                    }
                 }
+
+                nmod_poly_clear(t + i);
             }
             p = n_nextprime(p, 0);
+
+            nmod_poly_factor_init(cand_fac + i);
         }
         nmod_poly_clear(d);
         nmod_poly_clear(g);
-        nmod_poly_clear(t);
+
+        /* factor modulo the candidates in parallel */
+        pthread_mutex_init(&S->mutex, NULL);
+        S->next = 0;
+        S->num = num_cand;
+        S->t = t;
+        S->fac = cand_fac;
+
+        for (i = 0; i < num_workers; i++)
+            thread_pool_wake(global_thread_pool, handles[i],
+                                                   _zassenhaus_prime_worker, S);
+        _zassenhaus_prime_worker(S);
+        for (i = 0; i < num_workers; i++)
+        {
+            thread_pool_wait(global_thread_pool, handles[i]);
+            thread_pool_give_back(global_thread_pool, handles[i]);
+        }
+
+        pthread_mutex_destroy(&S->mutex);
+        if (handles != NULL)
+            flint_free(handles);
+
+        /* the last prime with the fewest local factors */
+        for (i = 0; i < num_cand; i++)
+        {
+            if (cand_fac[i].num <= r)
+            {
+                r = cand_fac[i].num;
+                nmod_poly_factor_set(fac, cand_fac + i);
+            }
+            nmod_poly_factor_clear(cand_fac + i);
+            nmod_poly_clear(t + i);
+        }
+        flint_free(cand_fac);
+        flint_free(t);
 
         p = (fac->p + 0)->mod.n;
             
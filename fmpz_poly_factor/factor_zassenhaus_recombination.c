@@ -12,121 +12,265 @@
 */
 
 #include <stdlib.h>
+#include "thread_pool.h"
 #include "fmpz_poly.h"
 
 #define TRACE 0
 
-void fmpz_poly_factor_zassenhaus_recombination(fmpz_poly_factor_t final_fac, 
-	const fmpz_poly_factor_t lifted_fac, 
-    const fmpz_poly_t F, const fmpz_t P, slong exp)
+/*
+    All subsets of k local factors are tried in lexicographic order, with
+    k increasing. For a fixed k the subsets are tested by all threads that
+    can be had from the global thread pool, each taking the next untested
+    subset. f and its leading coefficient do not change while this goes
+    on; the factors found are removed from f once every subset of size k
+    has been tried, in the order of their subsets, so that the result does
+    not depend on the number of threads.
+*/
+typedef struct
 {
-    const slong r = lifted_fac->num;
+    pthread_mutex_t mutex;
+    const fmpz_poly_factor_struct * lifted_fac;
+    const fmpz_poly_struct * f;
+    const fmpz * leadF;
+    const fmpz * P;
+    slong r;
+    slong k;
+    slong * used_arr;   /* local factors already in a factor of f */
+    slong * sub_arr;    /* the next subset to hand out */
+    slong rank;         /* the rank of sub_arr */
+    int done;           /* whether all subsets have been handed out */
+    fmpz_poly_struct * found;
+    slong * found_rank;
+    slong num_found;
+}
+_recombination_struct;
 
-    slong k, *used_arr, *sub_arr;
-    fmpz_poly_t f, Q, R, tryme;
-    fmpz *leadF;
+/* advance S->sub_arr to the next subset avoiding every used local factor */
+static void
+_next_subset(_recombination_struct * S)
+{
+    const slong r = S->r, k = S->k;
+    slong * sub_arr = S->sub_arr;
+    slong l, indx;
 
-    used_arr = flint_calloc(2 * r, sizeof(slong));
-    sub_arr  = used_arr + r;
+    while (1)
+    {
+        /* lexicographically next k-subset of {0, ..., r - 1} */
+        for (indx = k - 1; indx >= 0 && sub_arr[indx] == r - k + indx; indx--) ;
 
-    fmpz_poly_init(f);
+        if (indx < 0)
+        {
+            S->done = 1;
+            return;
+        }
+
+        sub_arr[indx]++;
+        for (l = indx + 1; l < k; l++)
+            sub_arr[l] = sub_arr[l - 1] + 1;
+        S->rank++;
+
+        for (l = 0; l < k; l++)
+            if (S->used_arr[sub_arr[l]])
+                break;
+
+        if (l == k)
+            return;
+    }
+}
+
+static void
+_recombination_worker(void * varg)
+{
+    _recombination_struct * S = (_recombination_struct *) varg;
+    const slong k = S->k;
+    slong l, rank, * sub;
+    fmpz_poly_t Q, R, tryme;
+    int skip;
+
+    sub = flint_malloc(k*sizeof(slong));
     fmpz_poly_init(Q);
     fmpz_poly_init(R);
     fmpz_poly_init(tryme);
-    fmpz_poly_set(f, F);
 
-#if TRACE == 1
-    fmpz_poly_factor_print(lifted_fac); flint_printf(" lifted_fac\n");
-#endif
+    while (1)
+    {
+        pthread_mutex_lock(&S->mutex);
+        if (S->done)
+        {
+            pthread_mutex_unlock(&S->mutex);
+            break;
+        }
+        for (l = 0; l < k; l++)
+            sub[l] = S->sub_arr[l];
+        rank = S->rank;
+        _next_subset(S);
+        pthread_mutex_unlock(&S->mutex);
 
-    leadF = fmpz_poly_lead(F);
+        /* Need to involve leadF, perhaps set coeff 0 to leadF and do 
+           leadF * rest and check if under M_bits... here I'm using a 
+           trial division... */
+        fmpz_poly_set_fmpz(tryme, S->leadF);
 
-    for (k = 1; k < r; k++)
-    {
-        slong count = 0, indx = k - 1, l;
+        for (l = 0; l < k; l++)
+            fmpz_poly_mul(tryme, tryme, S->lifted_fac->p + sub[l]);
 
-        for(l = 0; l < k; l++)
-            sub_arr[l] = l;
+        fmpz_poly_scalar_smod_fmpz(tryme, tryme, S->P);
+        fmpz_poly_primitive_part(tryme, tryme);
+        fmpz_poly_divrem(Q, R, S->f, tryme);
+
+#if TRACE == 1
+        fmpz_poly_print(tryme); flint_printf(" is tryme\n");
+        fmpz_poly_print(R); flint_printf(" is R\n");
+#endif
 
-        sub_arr[indx]--;
-        while ((indx >= 0))
+        if (fmpz_poly_is_zero(R))
         {
-            sub_arr[indx] = sub_arr[indx] + 1;
+            pthread_mutex_lock(&S->mutex);
+
+            fmpz_poly_swap(S->found + S->num_found, tryme);
+            S->found_rank[S->num_found] = rank;
+            S->num_found++;
 
-            for (l = indx + 1; l < k; l++)
-                sub_arr[l] = sub_arr[l - 1] + 1;
+            /*
+                The local factors of different factors of f are disjoint,
+                so no subset meeting this one needs to be tried.
+            */
+            for (l = 0; l < k; l++)
+                S->used_arr[sub[l]] = 1;
 
-            if (sub_arr[k - 1] > r - 1)
-                indx--;
-            else
+            skip = 0;
+            if (!S->done)
             {
-                for(l = 0; l < k; l++)
-                {
-                    if (used_arr[sub_arr[l]] == 1)
-                        break;
-                }
+                for (l = 0; l < k; l++)
+                    if (S->used_arr[S->sub_arr[l]])
+                        skip = 1;
+                if (skip)
+                    _next_subset(S);
+            }
+
+            pthread_mutex_unlock(&S->mutex);
+        }
+    }
 
-             /* Need to involve leadF, perhaps set coeff 0 to leadF and do 
-                leadF * rest and check if under M_bits... here I'm using a 
-                trial division... */
-                fmpz_poly_set_fmpz(tryme, leadF);
+    fmpz_poly_clear(Q);
+    fmpz_poly_clear(R);
+    fmpz_poly_clear(tryme);
+    flint_free(sub);
+}
 
-                for(l = 0; l < k; l++)
-                    fmpz_poly_mul(tryme, tryme, lifted_fac->p + (sub_arr[l]));
+void fmpz_poly_factor_zassenhaus_recombination(fmpz_poly_factor_t final_fac, 
+	const fmpz_poly_factor_t lifted_fac, 
+    const fmpz_poly_t F, const fmpz_t P, slong exp)
+{
+    const slong r = lifted_fac->num;
+
+    slong i, j, k, l, remaining, max_workers;
+    thread_pool_handle * handles = NULL;
+    fmpz_poly_t f, Q;
+    _recombination_struct S[1];
+
+    S->used_arr = flint_calloc(2 * r, sizeof(slong));
+    S->sub_arr  = S->used_arr + r;
+    S->found = flint_malloc(r*sizeof(fmpz_poly_struct));
+    S->found_rank = flint_malloc(r*sizeof(slong));
+    for (i = 0; i < r; i++)
+        fmpz_poly_init(S->found + i);
 
-                fmpz_poly_scalar_smod_fmpz(tryme, tryme, P);
-                fmpz_poly_primitive_part(tryme, tryme);
-                fmpz_poly_divrem(Q, R, f, tryme);
+    fmpz_poly_init(f);
+    fmpz_poly_init(Q);
+    fmpz_poly_set(f, F);
 
 #if TRACE == 1
-                fmpz_poly_print(tryme); flint_printf(" is tryme\n");
-                fmpz_poly_print(R); flint_printf(" is R\n");
+    fmpz_poly_factor_print(lifted_fac); flint_printf(" lifted_fac\n");
 #endif
 
-                if (fmpz_poly_is_zero(R))
-                {
-                    fmpz_poly_factor_insert(final_fac, tryme, exp);
+    pthread_mutex_init(&S->mutex, NULL);
+    S->lifted_fac = lifted_fac;
+    S->P = P;
+    S->r = r;
 
-                    for(l = 0; l < k; l++)
-                    {
-                        used_arr[sub_arr[l]] = 1;
-                        count++;
-                    }
+    max_workers = global_thread_pool_initialized ?
+                                 thread_pool_get_size(global_thread_pool) : 0;
+    if (max_workers > 0)
+        handles = flint_malloc(max_workers*sizeof(thread_pool_handle));
 
-                    fmpz_poly_set(f, Q);
-                    leadF = fmpz_poly_lead(f);
-                 /* If r - count = k then the rest are irreducible.  
-                    TODO: Add a test for that case */
-                }
+    /*
+        Each factor of f uses at least k local factors, so f is irreducible
+        once fewer than 2k local factors remain.
+    */
+    remaining = r;
+    for (k = 1; 2*k <= remaining; k++)
+    {
+        slong num_workers = 0;
+
+        S->f = f;
+        S->leadF = fmpz_poly_lead(f);
+        S->k = k;
+        S->num_found = 0;
+        S->rank = 0;
+        S->done = 0;
+
+        /* the first subset without used local factors */
+        for (l = 0; l < k; l++)
+            S->sub_arr[l] = l;
+        for (l = 0; l < k; l++)
+            if (S->used_arr[S->sub_arr[l]])
+                break;
+        if (l < k)
+            _next_subset(S);
 
-                indx = k - 1;
+        if (max_workers > 0 && !S->done)
+            num_workers = thread_pool_request(global_thread_pool,
+                                                         handles, max_workers);
+
+        for (i = 0; i < num_workers; i++)
+            thread_pool_wake(global_thread_pool, handles[i],
+                                                   _recombination_worker, S);
+        _recombination_worker(S);
+        for (i = 0; i < num_workers; i++)
+        {
+            thread_pool_wait(global_thread_pool, handles[i]);
+            thread_pool_give_back(global_thread_pool, handles[i]);
+        }
+
+        /* sort the factors found by the rank of their subsets */
+        for (i = 1; i < S->num_found; i++)
+        {
+            for (j = i; j > 0 && S->found_rank[j - 1] > S->found_rank[j]; j--)
+            {
+                slong t = S->found_rank[j];
+                S->found_rank[j] = S->found_rank[j - 1];
+                S->found_rank[j - 1] = t;
+                fmpz_poly_swap(S->found + j, S->found + j - 1);
             }
         }
 
-     /* This is where we switch to the next loop for k.  So we will have 
-        found all factors using <= k local factors.  We should/could update 
-        f to be the rest divided away (or multiply the remaining), could 
-        also adjust r.  It is the number of remaining factors so if you 
-        update then test if r = k or k+1 in which case the remaining f is 
-        irreducible. */
+        for (i = 0; i < S->num_found; i++)
+        {
+            fmpz_poly_factor_insert(final_fac, S->found + i, exp);
+            fmpz_poly_div(Q, f, S->found + i);
+            fmpz_poly_swap(f, Q);
+            remaining -= k;
+        }
     }
 
-    {
-        slong test = 0;
+    /* what is left of f is irreducible */
+    if (remaining > 0)
+        fmpz_poly_factor_insert(final_fac, f, exp);
 
-        for (k = 0; k < r; k++)
-            test = test + used_arr[k];
+    pthread_mutex_destroy(&S->mutex);
 
-        if (test == 0)
-            fmpz_poly_factor_insert(final_fac, f, exp);
-    }
+    if (handles != NULL)
+        flint_free(handles);
+
+    for (i = 0; i < r; i++)
+        fmpz_poly_clear(S->found + i);
+    flint_free(S->found);
+    flint_free(S->found_rank);
 
     fmpz_poly_clear(f);
-    fmpz_poly_clear(tryme);
     fmpz_poly_clear(Q);
-    fmpz_poly_clear(R);
-    flint_free(used_arr);
+    flint_free(S->used_arr);
 }
 
 #undef TRACE
-
@@ -159,6 +159,48 @@ main(void)
         fmpz_poly_factor_clear(fac);
     }
 
+    /* Check the number of factors does not depend on the number of threads */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t f, g;
+        fmpz_poly_factor_t fac1, fac2;
+        slong j, n = n_randint(state, 6) + 2;
+
+        fmpz_poly_init(f);
+        fmpz_poly_init(g);
+        fmpz_poly_factor_init(fac1);
+        fmpz_poly_factor_init(fac2);
+
+        /* large enough for the Hensel lifting to be threaded */
+        fmpz_poly_one(f);
+        for (j = 0; j < n; j++)
+        {
+            fmpz_poly_randtest_not_zero(g, state, n_randint(state, 40) + 2, 10);
+            fmpz_poly_mul(f, f, g);
+        }
+
+        flint_set_num_threads(1);
+        fmpz_poly_factor(fac1, f);
+
+        flint_set_num_threads(n_randint(state, 4) + 2);
+        fmpz_poly_factor(fac2, f);
+
+        result = (fac1->num == fac2->num);
+        if (!result)
+        {
+            flint_printf("FAIL (threads):\n");
+            flint_printf("f = "), fmpz_poly_print(f), flint_printf("\n\n");
+            flint_printf("fac1 = "), fmpz_poly_factor_print(fac1), flint_printf("\n\n");
+            flint_printf("fac2 = "), fmpz_poly_factor_print(fac2), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(g);
+        fmpz_poly_factor_clear(fac1);
+        fmpz_poly_factor_clear(fac2);
+    }
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
@@ -37,6 +37,8 @@ main(void)
         fmpz_poly_init(t);
         fmpz_poly_factor_init(fac);
 
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
         fmpz_randtest_not_zero(c, state, n_randint(state, 10) + 1);
         fmpz_poly_set_fmpz(f, c);
 
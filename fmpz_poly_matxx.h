@@ -226,6 +226,9 @@ struct fmpz_poly_mat_data
     {
         fmpz_poly_mat_init_set(inner, o.inner);
     }
+    FLINTXX_DEFINE_DATA_MOVE(fmpz_poly_mat_data,
+            fmpz_poly_mat_init(inner, 0, 0),
+            fmpz_poly_mat_swap(inner, o.inner))
 
     fmpz_poly_mat_data(fmpz_poly_matxx_srcref o)
     {
@@ -186,6 +186,8 @@ struct fmpz_poly_q_data
         fmpz_poly_q_init(inner);
         fmpz_poly_q_set(inner, o.inner);
     }
+    FLINTXX_DEFINE_DATA_MOVE(fmpz_poly_q_data, fmpz_poly_q_init(inner),
+            fmpz_poly_q_swap(inner, o.inner))
 
     fmpz_poly_q_data(fmpz_poly_qxx_srcref r)
     {
@@ -26,6 +26,7 @@
 #include "flintxx/flint_exception.h"
 #include "flintxx/frandxx.h"
 #include "flintxx/ltuple.h"
+#include "flintxx/temporary_pool.h"
 #include "flintxx/traits.h"
 #include "flintxx/traits_fwd.h"
 
@@ -33,7 +34,6 @@
 // TODO newton basis?
 // TODO power series class?
 // TODO input
-// TODO addmul
 // TODO more hensel lifting?
 
 namespace flint {
@@ -478,20 +478,33 @@ struct fmpz_poly_traits<fmpz_polyxx>
     };
 };
 
+struct fmpz_poly_pool_ops
+{
+    static void init(fmpz_poly_struct* p) {fmpz_poly_init(p);}
+    static void clear(fmpz_poly_struct* p) {fmpz_poly_clear(p);}
+    static void reset(fmpz_poly_struct* p) {fmpz_poly_zero(p);}
+    static slong capacity(const fmpz_poly_struct* p) {return p->alloc;}
+};
+
+// Default constructed polynomials (in particular temporaries) draw their
+// storage from a per-thread pool, and all polynomials give it back there.
 struct fmpz_poly_data
 {
     fmpz_poly_t inner;
     typedef fmpz_poly_t& data_ref_t;
     typedef const fmpz_poly_t& data_srcref_t;
+    typedef temporary_pool<fmpz_poly_struct, fmpz_poly_pool_ops> pool_t;
 
-    fmpz_poly_data() {fmpz_poly_init(inner);}
-    ~fmpz_poly_data() {fmpz_poly_clear(inner);}
+    fmpz_poly_data() {pool_t::acquire(inner);}
+    ~fmpz_poly_data() {pool_t::release(inner);}
 
     fmpz_poly_data(const fmpz_poly_data& o)
     {
         fmpz_poly_init(inner);
         fmpz_poly_set(inner, o.inner);
     }
+    FLINTXX_DEFINE_DATA_MOVE(fmpz_poly_data, fmpz_poly_init(inner),
+            fmpz_poly_swap(inner, o.inner))
 
     fmpz_poly_data(fmpz_polyxx_srcref r)
     {
@@ -918,6 +931,11 @@ FLINT_DEFINE_SIXARY_EXPR_COND6(hensel_lift_only_inverse_op,
         e5._fmpz(), e6._fmpz()))
 } // rules
 
+FLINTXX_DEFINE_TERNARY(fmpz_polyxx,
+        fmpz_poly_addmul(to._poly(), e1._poly(), e2._poly()),
+        fmpz_poly_submul(to._poly(), e1._poly(), e2._poly()),
+        FLINTXX_UNADORNED_MAKETYPES)
+
 // immediate functions
 // TODO make lazy when we have nmod class
 template<class Poly>
@@ -240,6 +240,30 @@ FLINT_DLL void _fmpz_vec_lcm(fmpz_t res, const fmpz * vec, slong len);
 
 FLINT_DLL void _fmpz_vec_dot(fmpz_t res, const fmpz * vec1, const fmpz * vec2, slong len2);
 
+/*  Product and remainder trees  *********************************************/
+
+#define FMPZ_VEC_TREE_FFT_CUTOFF 8000
+
+#define FMPZ_VEC_TREE_THREADED_CUTOFF 4096
+
+FLINT_DLL fmpz ** _fmpz_vec_tree_alloc(slong len);
+
+FLINT_DLL void _fmpz_vec_tree_free(fmpz ** tree, slong len);
+
+FLINT_DLL void _fmpz_vec_tree_build(fmpz ** tree, const fmpz * vec, slong len);
+
+FLINT_DLL void _fmpz_vec_tree_rem(fmpz * res, const fmpz_t x,
+                                             fmpz * const * tree, slong len);
+
+FLINT_DLL void _fmpz_vec_tree_rem_sqr(fmpz * res, const fmpz_t x,
+                                             fmpz * const * tree, slong len);
+
+FLINT_DLL void _fmpz_vec_batch_gcd(fmpz * res, const fmpz * vec, slong len);
+
+/*  Primality  ***************************************************************/
+
+FLINT_DLL void _fmpz_vec_is_probabprime(int * res, const fmpz * vec, slong len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,43 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+
+/*
+    Bernstein's batch gcd: with P the product of all the x_j, the quotient
+    (P mod x_i^2)/x_i is congruent to the product of the x_j with j != i
+    modulo x_i.
+*/
+void _fmpz_vec_batch_gcd(fmpz * res, const fmpz * vec, slong len)
+{
+    slong i, height;
+    fmpz ** tree;
+
+    if (len == 0)
+        return;
+
+    height = FLINT_CLOG2(len);
+    tree = _fmpz_vec_tree_alloc(len);
+
+    _fmpz_vec_tree_build(tree, vec, len);
+    _fmpz_vec_tree_rem_sqr(res, tree[height] + 0, tree, len);
+
+    for (i = 0; i < len; i++)
+    {
+        fmpz_divexact(res + i, res + i, vec + i);
+        fmpz_gcd(res + i, res + i, vec + i);
+    }
+
+    _fmpz_vec_tree_free(tree, len);
+}
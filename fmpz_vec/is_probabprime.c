@@ -0,0 +1,191 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <pthread.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "thread_pool.h"
+
+/* odd primes below this bound are removed by trial division */
+#define FMPZ_VEC_IS_PROBABPRIME_TRIAL_BOUND 1024
+
+typedef struct
+{
+    pthread_mutex_t mutex;
+    slong next;
+    slong num;
+    const slong * idx;
+    const fmpz * vec;
+    int * res;
+    const mp_limb_t * prods;
+    slong num_prods;
+}
+_is_probabprime_arg_struct;
+
+static int
+_mpz_is_probabprime(const __mpz_struct * n, const mp_limb_t * prods,
+                                                              slong num_prods)
+{
+    slong j;
+    mp_limb_t r;
+
+    if (mpz_even_p(n))
+        return 0;
+
+    /* n is larger than every trial prime */
+    for (j = 0; j < num_prods; j++)
+    {
+        r = mpn_mod_1(n->_mp_d, n->_mp_size, prods[j]);
+        if (n_gcd(prods[j], r) != 1)
+            return 0;
+    }
+
+    return mpz_probab_prime_p(n, 25) != 0;
+}
+
+/* Each thread repeatedly takes the next untested candidate. */
+static void
+_is_probabprime_worker(void * varg)
+{
+    _is_probabprime_arg_struct * arg = (_is_probabprime_arg_struct *) varg;
+    slong i, k;
+
+    while (1)
+    {
+        pthread_mutex_lock(&arg->mutex);
+        i = arg->next++;
+        pthread_mutex_unlock(&arg->mutex);
+
+        if (i >= arg->num)
+            return;
+
+        k = arg->idx[i];
+        arg->res[k] = _mpz_is_probabprime(COEFF_TO_PTR(arg->vec[k]),
+                                                 arg->prods, arg->num_prods);
+    }
+}
+
+void
+_fmpz_vec_is_probabprime(int * res, const fmpz * vec, slong len)
+{
+    slong i, j, num_small, num_large, num_primes;
+    slong * small_idx, * large_idx;
+    ulong * small;
+    int * small_res;
+    const mp_limb_t * primes;
+    mp_limb_t * prods;
+    _is_probabprime_arg_struct arg[1];
+
+    small_idx = (slong *) flint_malloc(len*sizeof(slong));
+    large_idx = (slong *) flint_malloc(len*sizeof(slong));
+    small = (ulong *) flint_malloc(len*sizeof(ulong));
+    small_res = (int *) flint_malloc(len*sizeof(int));
+
+    num_small = num_large = 0;
+    for (i = 0; i < len; i++)
+    {
+        if (fmpz_sgn(vec + i) <= 0)
+        {
+            res[i] = 0;
+        }
+        else if (!COEFF_IS_MPZ(vec[i]))
+        {
+            small_idx[num_small] = i;
+            small[num_small++] = vec[i];
+        }
+        else
+        {
+            large_idx[num_large++] = i;
+        }
+    }
+
+    /* n_is_probabprime is a proof of primality for single limbs */
+    n_is_prime_vec(small_res, small, num_small);
+    for (i = 0; i < num_small; i++)
+        res[small_idx[i]] = small_res[i];
+
+    if (num_large > 0)
+    {
+        /* group the trial primes into products that fit a limb */
+        num_primes = n_prime_pi(FMPZ_VEC_IS_PROBABPRIME_TRIAL_BOUND - 1);
+        primes = n_primes_arr_readonly(num_primes);
+        prods = (mp_limb_t *) flint_malloc(num_primes*sizeof(mp_limb_t));
+
+        arg->num_prods = 0;
+        prods[0] = 1;
+        for (j = 1; j < num_primes; j++)
+        {
+            mp_limb_t hi, lo;
+
+            umul_ppmm(hi, lo, prods[arg->num_prods], primes[j]);
+            if (hi != 0)
+            {
+                arg->num_prods++;
+                prods[arg->num_prods] = primes[j];
+            }
+            else
+            {
+                prods[arg->num_prods] = lo;
+            }
+        }
+        arg->num_prods++;
+
+        pthread_mutex_init(&arg->mutex, NULL);
+        arg->next = 0;
+        arg->num = num_large;
+        arg->idx = large_idx;
+        arg->vec = vec;
+        arg->res = res;
+        arg->prods = prods;
+
+        if (global_thread_pool_initialized && num_large > 1)
+        {
+            slong num_workers;
+            thread_pool_handle * handles;
+
+            num_workers = thread_pool_get_size(global_thread_pool);
+            num_workers = FLINT_MIN(num_workers, num_large - 1);
+            handles = (thread_pool_handle *) flint_malloc(
+                           FLINT_MAX(num_workers, 1)*sizeof(thread_pool_handle));
+            num_workers = thread_pool_request(global_thread_pool,
+                                                        handles, num_workers);
+
+            for (i = 0; i < num_workers; i++)
+                thread_pool_wake(global_thread_pool, handles[i],
+                                                  _is_probabprime_worker, arg);
+
+            _is_probabprime_worker(arg);
+
+            for (i = 0; i < num_workers; i++)
+            {
+                thread_pool_wait(global_thread_pool, handles[i]);
+                thread_pool_give_back(global_thread_pool, handles[i]);
+            }
+
+            flint_free(handles);
+        }
+        else
+        {
+            _is_probabprime_worker(arg);
+        }
+
+        pthread_mutex_destroy(&arg->mutex);
+        flint_free(prods);
+    }
+
+    flint_free(small_res);
+    flint_free(small);
+    flint_free(large_idx);
+    flint_free(small_idx);
+}
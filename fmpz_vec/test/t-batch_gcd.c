@@ -0,0 +1,91 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("batch_gcd....");
+    fflush(stdout);
+
+    for (i = 0; i < 500 * flint_test_multiplier(); i++)
+    {
+        fmpz * a, * g, * primes;
+        fmpz_t p, t;
+        slong j, k, len, nprimes;
+        mp_bitcnt_t bits;
+
+        len = n_randint(state, 30) + 1;
+        nprimes = n_randint(state, 2*len) + 1;
+        bits = n_randint(state, 150) + 2;
+
+        a = _fmpz_vec_init(len);
+        g = _fmpz_vec_init(len);
+        primes = _fmpz_vec_init(nprimes);
+        fmpz_init(p);
+        fmpz_init(t);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        /* moduli sharing factors, like RSA moduli from bad generators */
+        for (k = 0; k < nprimes; k++)
+            fmpz_randprime(primes + k, state, bits, 0);
+
+        for (j = 0; j < len; j++)
+        {
+            fmpz_mul(a + j, primes + n_randint(state, nprimes),
+                            primes + n_randint(state, nprimes));
+            if (n_randint(state, 4) == 0)
+                fmpz_neg(a + j, a + j);
+        }
+
+        _fmpz_vec_batch_gcd(g, a, len);
+
+        for (j = 0; j < len; j++)
+        {
+            fmpz_one(p);
+            for (k = 0; k < len; k++)
+                if (k != j)
+                    fmpz_mul(p, p, a + k);
+            fmpz_gcd(t, p, a + j);
+
+            result = fmpz_equal(t, g + j);
+            if (!result)
+            {
+                flint_printf("FAIL:\nlen = %wd, j = %wd\n", len, j);
+                fmpz_print(a + j); flint_printf("\n");
+                fmpz_print(t); flint_printf("\n");
+                fmpz_print(g + j); flint_printf("\n");
+                abort();
+            }
+        }
+
+        _fmpz_vec_clear(a, len);
+        _fmpz_vec_clear(g, len);
+        _fmpz_vec_clear(primes, nprimes);
+        fmpz_clear(p);
+        fmpz_clear(t);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,86 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i, j;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("is_probabprime....");
+    fflush(stdout);
+
+    for (i = 0; i < 300 * flint_test_multiplier(); i++)
+    {
+        slong len = n_randint(state, 50);
+        fmpz * a = _fmpz_vec_init(len);
+        int * res = flint_malloc((len + 1)*sizeof(int));
+        fmpz_t t;
+
+        fmpz_init(t);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        for (j = 0; j < len; j++)
+        {
+            mp_bitcnt_t bits = n_randint(state, 200) + 2;
+
+            switch (n_randint(state, 4))
+            {
+                case 0:
+                    fmpz_randtest(a + j, state, bits);
+                    break;
+                case 1:
+                    fmpz_randprime(a + j, state, bits, 0);
+                    break;
+                case 2:
+                    /* no small factors */
+                    fmpz_randprime(a + j, state, bits/2 + 2, 0);
+                    fmpz_randprime(t, state, bits/2 + 2, 0);
+                    fmpz_mul(a + j, a + j, t);
+                    break;
+                default:
+                    /* a small factor */
+                    fmpz_randprime(a + j, state, bits, 0);
+                    fmpz_mul_ui(a + j, a + j, n_randprime(state, 10, 0));
+            }
+        }
+
+        _fmpz_vec_is_probabprime(res, a, len);
+
+        for (j = 0; j < len; j++)
+        {
+            if (res[j] != fmpz_is_probabprime(a + j))
+            {
+                flint_printf("FAIL:\n");
+                fmpz_print(a + j); flint_printf("\n");
+                flint_printf("res = %d\n", res[j]);
+                abort();
+            }
+        }
+
+        fmpz_clear(t);
+        flint_free(res);
+        _fmpz_vec_clear(a, len);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
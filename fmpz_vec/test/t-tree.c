@@ -0,0 +1,116 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("tree....");
+    fflush(stdout);
+
+    for (i = 0; i < 500 * flint_test_multiplier(); i++)
+    {
+        fmpz * a, * r;
+        fmpz ** tree;
+        fmpz_t x, p, s;
+        slong j, len, height;
+        mp_bitcnt_t bits;
+
+        len = n_randint(state, 40) + 1;
+        bits = n_randint(state, 300) + 1;
+
+        /* large enough for the FFT and the threads */
+        if (i < 2)
+        {
+            len = 4 + n_randint(state, 2);
+            bits = FMPZ_VEC_TREE_FFT_CUTOFF*FLINT_BITS/2 + 1;
+        }
+
+        height = FLINT_CLOG2(len);
+
+        a = _fmpz_vec_init(len);
+        r = _fmpz_vec_init(len);
+        fmpz_init(x);
+        fmpz_init(p);
+        fmpz_init(s);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        for (j = 0; j < len; j++)
+            fmpz_randtest_not_zero(a + j, state, bits);
+
+        fmpz_randtest(x, state, n_randint(state, 3) == 0 ? 100 :
+                                                     len*bits + 100);
+        if (i < 2)
+            fmpz_randbits(x, state, 2*len*bits);
+
+        tree = _fmpz_vec_tree_alloc(len);
+        _fmpz_vec_tree_build(tree, a, len);
+
+        /* the root is the product */
+        _fmpz_vec_prod(p, a, len);
+        result = fmpz_equal(p, tree[height] + 0);
+        if (!result)
+        {
+            flint_printf("FAIL:\ncheck root, len = %wd\n", len);
+            abort();
+        }
+
+        /* remainders by the leaves and their squares */
+        _fmpz_vec_tree_rem(r, x, tree, len);
+        for (j = 0; j < len; j++)
+        {
+            fmpz_mod(s, x, a + j);
+            result = fmpz_equal(s, r + j);
+            if (!result)
+            {
+                flint_printf("FAIL:\ncheck rem, len = %wd, j = %wd\n", len, j);
+                abort();
+            }
+        }
+
+        _fmpz_vec_tree_rem_sqr(r, x, tree, len);
+        for (j = 0; j < len; j++)
+        {
+            fmpz_mul(s, a + j, a + j);
+            fmpz_mod(s, x, s);
+            result = fmpz_equal(s, r + j);
+            if (!result)
+            {
+                flint_printf("FAIL:\ncheck rem_sqr, len = %wd, j = %wd\n",
+                                                                      len, j);
+                abort();
+            }
+        }
+
+        _fmpz_vec_tree_free(tree, len);
+
+        _fmpz_vec_clear(a, len);
+        _fmpz_vec_clear(r, len);
+        fmpz_clear(x);
+        fmpz_clear(p);
+        fmpz_clear(s);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
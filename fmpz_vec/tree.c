@@ -0,0 +1,283 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fft.h"
+#include "thread_pool.h"
+
+#define _TREE_MUL 0
+#define _TREE_REM 1
+#define _TREE_REM_SQR 2
+
+typedef struct
+{
+    int op;
+    fmpz * res;
+    const fmpz * a;
+    const fmpz * b;
+    slong alen;
+    slong start;
+    slong stop;
+}
+_tree_arg_struct;
+
+/* number of nodes on level i of a tree with len leaves */
+#define _TREE_LEVEL_LEN(len, i) ((((len) - 1) >> (i)) + 1)
+
+/* as fmpz_mul, but using the FLINT FFT for large balanced operands */
+static void
+_fmpz_tree_mul(fmpz_t res, const fmpz_t a, const fmpz_t b)
+{
+    __mpz_struct * ma, * mb, * mr;
+    mp_size_t na, nb;
+
+    if (!COEFF_IS_MPZ(*a) || !COEFF_IS_MPZ(*b))
+    {
+        fmpz_mul(res, a, b);
+        return;
+    }
+
+    ma = COEFF_TO_PTR(*a);
+    mb = COEFF_TO_PTR(*b);
+    na = FLINT_ABS(ma->_mp_size);
+    nb = FLINT_ABS(mb->_mp_size);
+
+    if (na < nb)
+    {
+        __mpz_struct * mt = ma;
+        mp_size_t nt = na;
+        ma = mb; mb = mt;
+        na = nb; nb = nt;
+    }
+
+    if (nb < FMPZ_VEC_TREE_FFT_CUTOFF)
+    {
+        fmpz_mul(res, a, b);
+        return;
+    }
+
+    FLINT_ASSERT(res != a && res != b);
+
+    mr = _fmpz_promote(res);
+    if (mr->_mp_alloc < na + nb)
+        _mpz_realloc(mr, na + nb);
+
+    flint_mpn_mul_fft_main(mr->_mp_d, ma->_mp_d, na, mb->_mp_d, nb);
+
+    mr->_mp_size = na + nb - (mr->_mp_d[na + nb - 1] == 0);
+    if ((ma->_mp_size ^ mb->_mp_size) < 0)
+        mr->_mp_size = -mr->_mp_size;
+}
+
+static void
+_tree_worker(void * varg)
+{
+    _tree_arg_struct * arg = (_tree_arg_struct *) varg;
+    fmpz * res = arg->res;
+    const fmpz * a = arg->a;
+    const fmpz * b = arg->b;
+    slong j;
+
+    for (j = arg->start; j < arg->stop; j++)
+    {
+        if (arg->op == _TREE_MUL)
+        {
+            if (2*j + 1 < arg->alen)
+                _fmpz_tree_mul(res + j, a + 2*j, a + 2*j + 1);
+            else
+                fmpz_set(res + j, a + 2*j);
+        }
+        else if (arg->op == _TREE_REM)
+        {
+            fmpz_mod(res + j, a + j/2, b + j);
+        }
+        else if (fmpz_sgn(a + j/2) >= 0 &&
+                 fmpz_bits(a + j/2) + 1 < 2*fmpz_bits(b + j))
+        {
+            /* already reduced, no need to square */
+            fmpz_set(res + j, a + j/2);
+        }
+        else
+        {
+            fmpz_t t;
+            fmpz_init(t);
+            _fmpz_tree_mul(t, b + j, b + j);
+            fmpz_mod(res + j, a + j/2, t);
+            fmpz_clear(t);
+        }
+    }
+}
+
+/*
+    Run the worker on the nodes 0, ..., n - 1 of one level, split evenly
+    between the threads of the global thread pool if threaded is set.
+*/
+static void
+_tree_level(int op, fmpz * res, const fmpz * a, const fmpz * b, slong alen,
+                                                      slong n, int threaded)
+{
+    slong i, num_handles = 0;
+    thread_pool_handle * handles = NULL;
+    _tree_arg_struct * args;
+
+    if (threaded && n > 1 && global_thread_pool_initialized)
+    {
+        slong max_num_handles = thread_pool_get_size(global_thread_pool);
+        max_num_handles = FLINT_MIN(max_num_handles, n - 1);
+        if (max_num_handles > 0)
+        {
+            handles = (thread_pool_handle *) flint_malloc(max_num_handles
+                                                  *sizeof(thread_pool_handle));
+            num_handles = thread_pool_request(global_thread_pool,
+                                                    handles, max_num_handles);
+        }
+    }
+
+    args = (_tree_arg_struct *) flint_malloc((num_handles + 1)
+                                                   *sizeof(_tree_arg_struct));
+    for (i = 0; i <= num_handles; i++)
+    {
+        args[i].op = op;
+        args[i].res = res;
+        args[i].a = a;
+        args[i].b = b;
+        args[i].alen = alen;
+        args[i].start = (n*i)/(num_handles + 1);
+        args[i].stop = (n*(i + 1))/(num_handles + 1);
+    }
+
+    for (i = 0; i < num_handles; i++)
+        thread_pool_wake(global_thread_pool, handles[i],
+                                                   _tree_worker, args + i + 1);
+    _tree_worker(args + 0);
+    for (i = 0; i < num_handles; i++)
+    {
+        thread_pool_wait(global_thread_pool, handles[i]);
+        thread_pool_give_back(global_thread_pool, handles[i]);
+    }
+
+    if (handles != NULL)
+        flint_free(handles);
+    flint_free(args);
+}
+
+/* whether the levels of a tree with the given leaves are worth threading */
+static int
+_tree_threaded(const fmpz * vec, slong len)
+{
+    slong i, limbs = 0;
+
+    for (i = 0; i < len && limbs < FMPZ_VEC_TREE_THREADED_CUTOFF; i++)
+        limbs += fmpz_size(vec + i);
+
+    return limbs >= FMPZ_VEC_TREE_THREADED_CUTOFF;
+}
+
+fmpz ** _fmpz_vec_tree_alloc(slong len)
+{
+    fmpz ** tree = NULL;
+
+    if (len)
+    {
+        slong i, height = FLINT_CLOG2(len);
+
+        tree = (fmpz **) flint_malloc(sizeof(fmpz *) * (height + 1));
+        for (i = 0; i <= height; i++)
+            tree[i] = _fmpz_vec_init(_TREE_LEVEL_LEN(len, i));
+    }
+
+    return tree;
+}
+
+void _fmpz_vec_tree_free(fmpz ** tree, slong len)
+{
+    if (len)
+    {
+        slong i, height = FLINT_CLOG2(len);
+
+        for (i = 0; i <= height; i++)
+            _fmpz_vec_clear(tree[i], _TREE_LEVEL_LEN(len, i));
+
+        flint_free(tree);
+    }
+}
+
+void _fmpz_vec_tree_build(fmpz ** tree, const fmpz * vec, slong len)
+{
+    slong i, height;
+    int threaded;
+
+    if (len == 0)
+        return;
+
+    height = FLINT_CLOG2(len);
+    threaded = _tree_threaded(vec, len);
+
+    _fmpz_vec_set(tree[0], vec, len);
+
+    for (i = 0; i < height; i++)
+        _tree_level(_TREE_MUL, tree[i + 1], tree[i], NULL,
+                    _TREE_LEVEL_LEN(len, i), _TREE_LEVEL_LEN(len, i + 1),
+                    threaded);
+}
+
+static void
+_fmpz_vec_tree_rem_op(fmpz * res, const fmpz_t x,
+                                     fmpz * const * tree, slong len, int op)
+{
+    slong i, height;
+    fmpz * t, * u;
+    int threaded;
+
+    if (len == 0)
+        return;
+
+    height = FLINT_CLOG2(len);
+    threaded = _tree_threaded(tree[0], len);
+
+    t = _fmpz_vec_init(len);
+    u = _fmpz_vec_init(len);
+
+    /* the root level, with x as its parent remainder */
+    _tree_level(op, t, x, tree[height], 0, 1, 0);
+
+    /* remainders on level i - 1 from those on level i */
+    for (i = height; i > 0; i--)
+    {
+        _tree_level(op, u, t, tree[i - 1], 0,
+                                        _TREE_LEVEL_LEN(len, i - 1), threaded);
+        {
+            fmpz * v = t;
+            t = u;
+            u = v;
+        }
+    }
+
+    _fmpz_vec_swap(res, t, len);
+
+    _fmpz_vec_clear(t, len);
+    _fmpz_vec_clear(u, len);
+}
+
+void _fmpz_vec_tree_rem(fmpz * res, const fmpz_t x,
+                                             fmpz * const * tree, slong len)
+{
+    _fmpz_vec_tree_rem_op(res, x, tree, len, _TREE_REM);
+}
+
+void _fmpz_vec_tree_rem_sqr(fmpz * res, const fmpz_t x,
+                                             fmpz * const * tree, slong len)
+{
+    _fmpz_vec_tree_rem_op(res, x, tree, len, _TREE_REM_SQR);
+}
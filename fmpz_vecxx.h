@@ -33,6 +33,8 @@ struct fmpz_vector_data
     {
         _fmpz_vec_set(array, o.array, size);
     }
+    FLINTXX_DEFINE_DATA_MOVE(fmpz_vector_data, size = 0; array = 0,
+            std::swap(size, o.size); std::swap(array, o.array))
 
     fmpzxx_ref at(slong i) {return fmpzxx_ref::make(array + i);}
     fmpzxx_srcref at(slong i) const {return fmpzxx_srcref::make(array + i);}
@@ -308,6 +308,8 @@ struct fmpz_data
     fmpz_data() {fmpz_init(inner);}
     ~fmpz_data() {fmpz_clear(inner);}
     fmpz_data(const fmpz_data& o) {fmpz_init_set(inner, o.inner);}
+    FLINTXX_DEFINE_DATA_MOVE(fmpz_data, fmpz_init(inner),
+            fmpz_swap(inner, o.inner))
 
     template<class T>
     fmpz_data(const T& t)
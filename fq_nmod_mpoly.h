@@ -1182,6 +1182,37 @@ FLINT_DLL void fq_nmod_mpoly_geobucket_pow_fmpz_inplace(fq_nmod_mpoly_geobucket_
 FLINT_DLL int fq_nmod_mpoly_geobucket_divides_inplace(fq_nmod_mpoly_geobucket_t B1,
                   fq_nmod_mpoly_geobucket_t B2, const fq_nmod_mpoly_ctx_t ctx);
 
+/* builders ******************************************************************/
+
+typedef struct fq_nmod_mpoly_builder
+{
+    fq_nmod_struct * coeffs;
+    slong alloc;
+    mpoly_exp_builder_t exps;
+} fq_nmod_mpoly_builder_struct;
+
+typedef fq_nmod_mpoly_builder_struct fq_nmod_mpoly_builder_t[1];
+
+FLINT_DLL void fq_nmod_mpoly_builder_init(fq_nmod_mpoly_builder_t B,
+                                   slong alloc, const fq_nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL void fq_nmod_mpoly_builder_clear(fq_nmod_mpoly_builder_t B,
+                                                const fq_nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL void fq_nmod_mpoly_builder_fit_length(fq_nmod_mpoly_builder_t B,
+                                     slong len, const fq_nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL void fq_nmod_mpoly_builder_push_terms_fq_nmod_ui(
+                     fq_nmod_mpoly_builder_t B, const fq_nmod_struct * c,
+               const ulong * exps, slong len, const fq_nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL void fq_nmod_mpoly_builder_push_terms_fq_nmod_fmpz(
+                     fq_nmod_mpoly_builder_t B, const fq_nmod_struct * c,
+                const fmpz * exps, slong len, const fq_nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL void fq_nmod_mpoly_builder_finish(fq_nmod_mpoly_t A,
+                     fq_nmod_mpoly_builder_t B, const fq_nmod_mpoly_ctx_t ctx);
+
 
 /******************************************************************************
 
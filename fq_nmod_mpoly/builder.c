@@ -0,0 +1,117 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fq_nmod_mpoly.h"
+
+void fq_nmod_mpoly_builder_init(fq_nmod_mpoly_builder_t B, slong alloc,
+                                                 const fq_nmod_mpoly_ctx_t ctx)
+{
+    slong i;
+
+    alloc = FLINT_MAX(alloc, 0);
+    B->coeffs = NULL;
+    if (alloc > 0)
+    {
+        B->coeffs = (fq_nmod_struct *) flint_malloc(alloc
+                                                   *sizeof(fq_nmod_struct));
+        for (i = 0; i < alloc; i++)
+            fq_nmod_init(B->coeffs + i, ctx->fqctx);
+    }
+    B->alloc = alloc;
+    mpoly_exp_builder_init(B->exps, alloc, ctx->minfo);
+}
+
+void fq_nmod_mpoly_builder_clear(fq_nmod_mpoly_builder_t B,
+                                                 const fq_nmod_mpoly_ctx_t ctx)
+{
+    slong i;
+
+    for (i = 0; i < B->alloc; i++)
+        fq_nmod_clear(B->coeffs + i, ctx->fqctx);
+
+    if (B->coeffs != NULL)
+        flint_free(B->coeffs);
+
+    mpoly_exp_builder_clear(B->exps, ctx->minfo);
+}
+
+void fq_nmod_mpoly_builder_fit_length(fq_nmod_mpoly_builder_t B, slong len,
+                                                 const fq_nmod_mpoly_ctx_t ctx)
+{
+    slong i, new_alloc;
+
+    if (len <= B->alloc)
+        return;
+
+    new_alloc = FLINT_MAX(len, 2*B->alloc);
+    B->coeffs = (fq_nmod_struct *) flint_realloc(B->coeffs,
+                                           new_alloc*sizeof(fq_nmod_struct));
+    for (i = B->alloc; i < new_alloc; i++)
+        fq_nmod_init(B->coeffs + i, ctx->fqctx);
+    B->alloc = new_alloc;
+
+    mpoly_exp_builder_realloc(B->exps, new_alloc, ctx->minfo);
+}
+
+static void _fq_nmod_mpoly_builder_push_coeffs(fq_nmod_mpoly_builder_t B,
+        const fq_nmod_struct * c, slong len, const fq_nmod_mpoly_ctx_t ctx)
+{
+    slong i, old_length = B->exps->length;
+
+    fq_nmod_mpoly_builder_fit_length(B, old_length + len, ctx);
+
+    for (i = 0; i < len; i++)
+        fq_nmod_set(B->coeffs + old_length + i, c + i, ctx->fqctx);
+}
+
+void fq_nmod_mpoly_builder_push_terms_fq_nmod_ui(fq_nmod_mpoly_builder_t B,
+                              const fq_nmod_struct * c, const ulong * exps,
+                                    slong len, const fq_nmod_mpoly_ctx_t ctx)
+{
+    _fq_nmod_mpoly_builder_push_coeffs(B, c, len, ctx);
+    mpoly_exp_builder_push_ui(B->exps, exps, len, ctx->minfo);
+}
+
+void fq_nmod_mpoly_builder_push_terms_fq_nmod_fmpz(fq_nmod_mpoly_builder_t B,
+                               const fq_nmod_struct * c, const fmpz * exps,
+                                     slong len, const fq_nmod_mpoly_ctx_t ctx)
+{
+    _fq_nmod_mpoly_builder_push_coeffs(B, c, len, ctx);
+    mpoly_exp_builder_push_fmpz(B->exps, exps, len, ctx->minfo);
+}
+
+/*
+    The coefficient array of B is handed over to A as is, and the exponents
+    are packed once into a fresh array at the final bit count. B is left
+    empty and may be reused.
+*/
+void fq_nmod_mpoly_builder_finish(fq_nmod_mpoly_t A,
+                     fq_nmod_mpoly_builder_t B, const fq_nmod_mpoly_ctx_t ctx)
+{
+    slong len = B->exps->length;
+    ulong * exps;
+    mp_bitcnt_t bits;
+
+    bits = mpoly_exp_builder_pack(&exps, B->alloc, B->exps, ctx->minfo);
+
+    fq_nmod_mpoly_clear(A, ctx);
+    A->coeffs = B->coeffs;
+    A->exps = exps;
+    A->alloc = B->alloc;
+    A->length = len;
+    A->bits = bits;
+
+    B->coeffs = NULL;
+    B->alloc = 0;
+
+    fq_nmod_mpoly_sort_terms(A, ctx);
+    fq_nmod_mpoly_combine_like_terms(A, ctx);
+}
@@ -142,6 +142,27 @@ void fq_nmod_mpoly_sort_terms(fq_nmod_mpoly_t A, const fq_nmod_mpoly_ctx_t ctx)
     ptempexp = (ulong *) TMP_ALLOC(N*sizeof(ulong));
     mpoly_get_cmpmask(ptempexp, N, A->bits, ctx->minfo);
 
+    if (A->length >= MPOLY_RADIX_SORT_CUTOFF)
+    {
+        slong * perm = (slong *) flint_malloc(A->length*sizeof(slong));
+        fq_nmod_struct * coeffs = (fq_nmod_struct *) flint_malloc(A->alloc*sizeof(fq_nmod_struct));
+
+        mpoly_radix_sort_exps(perm, A->exps, A->length, N, ptempexp);
+
+        /* move the coefficients by shallow copies */
+        for (i = 0; i < A->length; i++)
+            coeffs[i] = A->coeffs[perm[i]];
+        for ( ; i < A->alloc; i++)
+            coeffs[i] = A->coeffs[i];
+
+        flint_free(A->coeffs);
+        A->coeffs = coeffs;
+        flint_free(perm);
+
+        TMP_END;
+        return;
+    }
+
     himask = 0;
     for (i = 0; i < A->length; i++)
     {
@@ -0,0 +1,134 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "fq_nmod_vec.h"
+#include "fq_nmod_mpoly.h"
+
+int
+main(void)
+{
+    slong i, j, k, l;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("builder....");
+    fflush(stdout);
+
+    /* Check builder matches push_term, sort and combine */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        fq_nmod_mpoly_ctx_t ctx;
+        fq_nmod_mpoly_t f, g;
+        fq_nmod_mpoly_builder_t B;
+        slong nvars, len, round;
+
+        fq_nmod_mpoly_ctx_init_rand(ctx, state, 10, FLINT_BITS, 5);
+        fq_nmod_mpoly_init(f, ctx);
+        fq_nmod_mpoly_init(g, ctx);
+        fq_nmod_mpoly_builder_init(B, n_randint(state, 50), ctx);
+
+        nvars = fq_nmod_mpoly_ctx_nvars(ctx);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        /* the builder may be reused after finishing */
+        for (round = 0; round < 2; round++)
+        {
+            slong num_chunks = n_randint(state, 4) + (i < 2);
+
+            fq_nmod_mpoly_zero(f, ctx);
+
+            for (j = 0; j < num_chunks; j++)
+            {
+                fq_nmod_struct * c;
+                ulong * exps;
+                fmpz * fexps;
+                fmpz ** fexp_ptrs;
+                mp_bitcnt_t exp_bits;
+                int use_fmpz = n_randint(state, 3) == 0;
+
+                len = n_randint(state, 100);
+                if (i < 2 && j == 0)
+                    len = 3*MPOLY_EXP_BUILDER_THREADED_CUTOFF;
+
+                c = _fq_nmod_vec_init(len, ctx->fqctx);
+                for (k = 0; k < len; k++)
+                    fq_nmod_randtest(c + k, state, ctx->fqctx);
+
+                if (use_fmpz)
+                {
+                    exp_bits = n_randint(state, 200) + 1;
+                    fexps = _fmpz_vec_init(len*nvars);
+                    fexp_ptrs = (fmpz **) flint_malloc(nvars*sizeof(fmpz *));
+                    for (k = 0; k < len*nvars; k++)
+                        fmpz_randtest_unsigned(fexps + k, state, exp_bits);
+
+                    fq_nmod_mpoly_builder_push_terms_fq_nmod_fmpz(B, c, fexps,
+                                                                    len, ctx);
+                    for (k = 0; k < len; k++)
+                    {
+                        for (l = 0; l < nvars; l++)
+                            fexp_ptrs[l] = fexps + nvars*k + l;
+                        fq_nmod_mpoly_push_term_fq_nmod_fmpz(f, c + k,
+                                                              fexp_ptrs, ctx);
+                    }
+
+                    flint_free(fexp_ptrs);
+                    _fmpz_vec_clear(fexps, len*nvars);
+                }
+                else
+                {
+                    /* few bits give many repeated monomials */
+                    exp_bits = n_randint(state, FLINT_BITS) + 1;
+                    exps = (ulong *) flint_malloc((len*nvars + 1)
+                                                              *sizeof(ulong));
+                    for (k = 0; k < len*nvars; k++)
+                        exps[k] = n_randlimb(state) >> (FLINT_BITS - exp_bits);
+
+                    fq_nmod_mpoly_builder_push_terms_fq_nmod_ui(B, c, exps,
+                                                                    len, ctx);
+                    for (k = 0; k < len; k++)
+                        fq_nmod_mpoly_push_term_fq_nmod_ui(f, c + k,
+                                                         exps + nvars*k, ctx);
+
+                    flint_free(exps);
+                }
+
+                _fq_nmod_vec_clear(c, len, ctx->fqctx);
+            }
+
+            fq_nmod_mpoly_sort_terms(f, ctx);
+            fq_nmod_mpoly_combine_like_terms(f, ctx);
+
+            fq_nmod_mpoly_builder_finish(g, B, ctx);
+            fq_nmod_mpoly_assert_canonical(g, ctx);
+
+            if (!fq_nmod_mpoly_equal(f, g, ctx))
+            {
+                printf("FAIL\n");
+                flint_printf("Check builder matches push_term\n"
+                                      "i = %wd, round = %wd\n", i, round);
+                flint_abort();
+            }
+        }
+
+        fq_nmod_mpoly_builder_clear(B, ctx);
+        fq_nmod_mpoly_clear(f, ctx);
+        fq_nmod_mpoly_clear(g, ctx);
+        fq_nmod_mpoly_ctx_clear(ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
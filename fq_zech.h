@@ -34,6 +34,19 @@ typedef struct
 
 typedef fq_zech_struct fq_zech_t[1];
 
+/* Zech log tables, shared by all contexts with the same modulus */
+typedef struct fq_zech_tables_struct
+{
+    mp_limb_t *zech_log_table;
+    mp_limb_t *prime_field_table;
+    mp_limb_t *eval_table;
+    nmod_poly_t modulus;
+    slong refcount;
+    void *map;                  /* file mapping holding the tables, or NULL */
+    size_t map_size;
+    struct fq_zech_tables_struct *next;
+} fq_zech_tables_struct;
+
 typedef struct
 {
     mp_limb_t qm1;              /* q - 1 */
@@ -49,6 +62,7 @@ typedef struct
     fq_nmod_ctx_struct *fq_nmod_ctx;
     int owns_fq_nmod_ctx;
 
+    fq_zech_tables_struct *tables;
 } fq_zech_ctx_struct;
 
 typedef fq_zech_ctx_struct fq_zech_ctx_t[1];
@@ -73,6 +87,20 @@ FLINT_DLL void fq_zech_ctx_randtest_reducible(fq_zech_ctx_t ctx, flint_rand_t st
 
 FLINT_DLL void fq_zech_ctx_clear(fq_zech_ctx_t ctx);
 
+FLINT_DLL fq_zech_tables_struct * _fq_zech_tables_acquire(
+                               const fq_nmod_ctx_t fq_nmod_ctx, mp_limb_t q);
+
+FLINT_DLL void _fq_zech_tables_release(fq_zech_tables_struct * tables);
+
+FLINT_DLL void _fq_zech_ctx_init_fq_nmod_ctx_tables(fq_zech_ctx_t ctx,
+                   fq_nmod_ctx_t fq_nmod_ctx, fq_zech_tables_struct * tables);
+
+FLINT_DLL int fq_zech_ctx_write_tables(const fq_zech_ctx_t ctx,
+                                                       const char * filename);
+
+FLINT_DLL int fq_zech_ctx_init_file(fq_zech_ctx_t ctx, const char * filename,
+                                                            const char * var);
+
 FQ_ZECH_INLINE const nmod_poly_struct* fq_zech_ctx_modulus(const fq_zech_ctx_t ctx)
 {
     return fq_nmod_ctx_modulus(ctx->fq_nmod_ctx);
@@ -0,0 +1,407 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "flint.h"
+#include "fq_zech.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define FQ_ZECH_USE_MMAP 1
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#else
+#define FQ_ZECH_USE_MMAP 0
+#endif
+
+/*
+    Tables are shared by all contexts with the same modulus (which determines
+    the prime) through a process wide list, protected by a lock. A table is
+    freed, or unmapped, when the last context using it is cleared.
+*/
+
+#if FLINT_REENTRANT
+#include <pthread.h>
+static pthread_mutex_t _fq_zech_tables_lock = PTHREAD_MUTEX_INITIALIZER;
+#define TABLES_LOCK() pthread_mutex_lock(&_fq_zech_tables_lock)
+#define TABLES_UNLOCK() pthread_mutex_unlock(&_fq_zech_tables_lock)
+#else
+#define TABLES_LOCK()
+#define TABLES_UNLOCK()
+#endif
+
+static fq_zech_tables_struct * _fq_zech_tables_list = NULL;
+
+/* file layout, all words being limbs: a header of FQ_ZECH_FILE_HEADER words
+   (magic, FLINT_BITS, p, d, q), the d + 1 coefficients of the modulus, then
+   the zech log table (q words), prime field table (p) and eval table (q) */
+#define FQ_ZECH_FILE_MAGIC UWORD(0x46515a4543485442) /* "FQZECHTB" */
+#define FQ_ZECH_FILE_HEADER 5
+
+static int
+_fq_zech_tables_match(const fq_zech_tables_struct * T,
+                                                  const nmod_poly_t modulus)
+{
+    return T->modulus->mod.n == modulus->mod.n
+        && nmod_poly_equal(T->modulus, modulus);
+}
+
+/* must be called with the lock held */
+static fq_zech_tables_struct *
+_fq_zech_tables_find(const nmod_poly_t modulus)
+{
+    fq_zech_tables_struct * T;
+
+    for (T = _fq_zech_tables_list; T != NULL; T = T->next)
+    {
+        if (_fq_zech_tables_match(T, modulus))
+            return T;
+    }
+
+    return NULL;
+}
+
+static void
+_fq_zech_tables_free(fq_zech_tables_struct * T)
+{
+    if (T->map != NULL)
+    {
+#if FQ_ZECH_USE_MMAP
+        munmap(T->map, T->map_size);
+#else
+        flint_free(T->map);
+#endif
+    }
+    else
+    {
+        flint_free(T->zech_log_table);
+        flint_free(T->prime_field_table);
+        flint_free(T->eval_table);
+    }
+
+    nmod_poly_clear(T->modulus);
+    flint_free(T);
+}
+
+/*
+    Register T unless tables for the same modulus appeared in the meantime,
+    in which case T is freed and those are returned instead. In both cases
+    the reference count of the result is incremented.
+*/
+static fq_zech_tables_struct *
+_fq_zech_tables_insert(fq_zech_tables_struct * T)
+{
+    fq_zech_tables_struct * S;
+
+    TABLES_LOCK();
+
+    S = _fq_zech_tables_find(T->modulus);
+    if (S == NULL)
+    {
+        T->refcount = 0;
+        T->next = _fq_zech_tables_list;
+        _fq_zech_tables_list = T;
+        S = T;
+    }
+    S->refcount++;
+
+    TABLES_UNLOCK();
+
+    if (S != T)
+        _fq_zech_tables_free(T);
+
+    return S;
+}
+
+static fq_zech_tables_struct *
+_fq_zech_tables_compute(const fq_nmod_ctx_t fq_nmod_ctx, mp_limb_t q)
+{
+    fq_zech_tables_struct * T;
+    mp_limb_t i, j, n, nz, qm1, up, result_ui;
+    mp_limb_t * n_reverse_table;
+    fq_nmod_t r, gen;
+    fmpz_t result;
+
+    T = (fq_zech_tables_struct *) flint_malloc(sizeof(fq_zech_tables_struct));
+    nmod_poly_init_mod(T->modulus, fq_nmod_ctx_modulus(fq_nmod_ctx)->mod);
+    nmod_poly_set(T->modulus, fq_nmod_ctx_modulus(fq_nmod_ctx));
+    T->map = NULL;
+    T->map_size = 0;
+
+    qm1 = q - 1;
+    up = fmpz_get_ui(fq_nmod_ctx_prime(fq_nmod_ctx));
+
+    T->zech_log_table = (mp_limb_t *) flint_malloc(q * sizeof(mp_limb_t));
+    T->prime_field_table = (mp_limb_t *) flint_malloc(up * sizeof(mp_limb_t));
+    n_reverse_table = (mp_limb_t *) flint_malloc(q * sizeof(mp_limb_t));
+    T->eval_table = (mp_limb_t *) flint_malloc(q * sizeof(mp_limb_t));
+
+    T->zech_log_table[qm1] = 0;
+    T->prime_field_table[0] = qm1;
+    for (i = 0; i < q; i++)
+        n_reverse_table[i] = qm1;
+    T->eval_table[qm1] = 0;
+
+    fq_nmod_init(r, fq_nmod_ctx);
+    fq_nmod_init(gen, fq_nmod_ctx);
+    fq_nmod_one(r, fq_nmod_ctx);
+    fq_nmod_gen(gen, fq_nmod_ctx);
+
+    fmpz_init(result);
+
+    for (i = 0; i < qm1; i++)
+    {
+        nmod_poly_evaluate_fmpz(result, r, fq_nmod_ctx_prime(fq_nmod_ctx));
+        result_ui = fmpz_get_ui(result);
+        if (n_reverse_table[result_ui] != qm1)
+        {
+            flint_printf("Exception (fq_zech_ctx_init_nmod_ctx). Polynomial is not primitive.\n");
+            flint_abort();
+        }
+        n_reverse_table[result_ui] = i;
+        T->eval_table[i] = result_ui;
+        if (r->length == 1)
+        {
+            T->prime_field_table[result_ui] = i;
+        }
+        fq_nmod_mul(r, r, gen, fq_nmod_ctx);
+    }
+
+    for (i = 0; i < q; i++)
+    {
+        j = n_reverse_table[i];
+        n = i;
+        if (n % up == up - 1)
+        {
+            nz = n - up + 1;
+        }
+        else
+        {
+            nz = n + 1;
+        }
+        T->zech_log_table[j] = n_reverse_table[nz];
+    }
+
+    fq_nmod_clear(r, fq_nmod_ctx);
+    fq_nmod_clear(gen, fq_nmod_ctx);
+    flint_free(n_reverse_table);
+    fmpz_clear(result);
+
+    return T;
+}
+
+fq_zech_tables_struct *
+_fq_zech_tables_acquire(const fq_nmod_ctx_t fq_nmod_ctx, mp_limb_t q)
+{
+    fq_zech_tables_struct * T;
+
+    TABLES_LOCK();
+    T = _fq_zech_tables_find(fq_nmod_ctx_modulus(fq_nmod_ctx));
+    if (T != NULL)
+        T->refcount++;
+    TABLES_UNLOCK();
+
+    if (T != NULL)
+        return T;
+
+    /* build without holding the lock */
+    return _fq_zech_tables_insert(_fq_zech_tables_compute(fq_nmod_ctx, q));
+}
+
+void
+_fq_zech_tables_release(fq_zech_tables_struct * T)
+{
+    fq_zech_tables_struct ** link;
+    int last;
+
+    TABLES_LOCK();
+
+    last = (--T->refcount == 0);
+    if (last)
+    {
+        for (link = &_fq_zech_tables_list; *link != T; link = &(*link)->next)
+            ;
+        *link = T->next;
+    }
+
+    TABLES_UNLOCK();
+
+    if (last)
+        _fq_zech_tables_free(T);
+}
+
+int
+fq_zech_ctx_write_tables(const fq_zech_ctx_t ctx, const char * filename)
+{
+    const nmod_poly_struct * modulus = fq_zech_ctx_modulus(ctx);
+    mp_limb_t header[FQ_ZECH_FILE_HEADER];
+    mp_limb_t q = ctx->qm1 + 1;
+    size_t d1 = modulus->length;
+    FILE * file;
+    int ok;
+
+    file = fopen(filename, "wb");
+    if (file == NULL)
+        return 0;
+
+    header[0] = FQ_ZECH_FILE_MAGIC;
+    header[1] = FLINT_BITS;
+    header[2] = ctx->p;
+    header[3] = d1 - 1;
+    header[4] = q;
+
+    ok = fwrite(header, sizeof(mp_limb_t), FQ_ZECH_FILE_HEADER, file)
+                                                        == FQ_ZECH_FILE_HEADER
+      && fwrite(modulus->coeffs, sizeof(mp_limb_t), d1, file) == d1
+      && fwrite(ctx->zech_log_table, sizeof(mp_limb_t), q, file) == q
+      && fwrite(ctx->prime_field_table, sizeof(mp_limb_t), ctx->p, file)
+                                                                   == ctx->p
+      && fwrite(ctx->eval_table, sizeof(mp_limb_t), q, file) == q;
+
+    ok = (fclose(file) == 0) && ok;
+
+    return ok;
+}
+
+/*
+    Map (or read) the table file, check its header and sizes, and return
+    the tables it contains with modulus set. Returns NULL on failure.
+*/
+static fq_zech_tables_struct *
+_fq_zech_tables_map(const char * filename)
+{
+    fq_zech_tables_struct * T;
+    mp_limb_t * data, p, d, q, t;
+    size_t size, words;
+    slong i;
+#if FQ_ZECH_USE_MMAP
+    struct stat st;
+    int fd;
+
+    fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+
+    if (fstat(fd, &st) != 0 || st.st_size <= 0)
+    {
+        close(fd);
+        return NULL;
+    }
+
+    size = (size_t) st.st_size;
+    data = (mp_limb_t *) mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (data == (mp_limb_t *) MAP_FAILED)
+        return NULL;
+#else
+    FILE * file;
+    long len;
+
+    file = fopen(filename, "rb");
+    if (file == NULL)
+        return NULL;
+
+    if (fseek(file, 0, SEEK_END) != 0 || (len = ftell(file)) <= 0
+                                      || fseek(file, 0, SEEK_SET) != 0)
+    {
+        fclose(file);
+        return NULL;
+    }
+
+    size = (size_t) len;
+    data = (mp_limb_t *) flint_malloc(size);
+    if (fread(data, 1, size, file) != size)
+    {
+        fclose(file);
+        flint_free(data);
+        return NULL;
+    }
+    fclose(file);
+#endif
+
+    words = size / sizeof(mp_limb_t);
+
+    if (words < FQ_ZECH_FILE_HEADER || data[0] != FQ_ZECH_FILE_MAGIC
+                                    || data[1] != FLINT_BITS)
+        goto fail;
+
+    p = data[2];
+    d = data[3];
+    q = data[4];
+
+    if (p < 2 || d < 1 || q < p || d >= words || q >= words
+         || size != (FQ_ZECH_FILE_HEADER + d + 1 + 2*q + p)*sizeof(mp_limb_t)
+         || data[FQ_ZECH_FILE_HEADER + d] != 1)
+        goto fail;
+
+    for (i = 0, t = 1; i < d; i++)
+    {
+        if (t > q / p)
+            goto fail;
+        t *= p;
+    }
+
+    if (t != q)
+        goto fail;
+
+    for (i = 0; i < d; i++)
+    {
+        if (data[FQ_ZECH_FILE_HEADER + i] >= p)
+            goto fail;
+    }
+
+    T = (fq_zech_tables_struct *) flint_malloc(sizeof(fq_zech_tables_struct));
+    nmod_poly_init2(T->modulus, p, d + 1);
+    for (i = 0; i <= d; i++)
+        nmod_poly_set_coeff_ui(T->modulus, i, data[FQ_ZECH_FILE_HEADER + i]);
+    T->zech_log_table = data + FQ_ZECH_FILE_HEADER + d + 1;
+    T->prime_field_table = T->zech_log_table + q;
+    T->eval_table = T->prime_field_table + p;
+    T->map = data;
+    T->map_size = size;
+
+    return T;
+
+fail:
+#if FQ_ZECH_USE_MMAP
+    munmap(data, size);
+#else
+    flint_free(data);
+#endif
+    return NULL;
+}
+
+int
+fq_zech_ctx_init_file(fq_zech_ctx_t ctx, const char * filename,
+                                                             const char * var)
+{
+    fq_zech_tables_struct * T;
+    fq_nmod_ctx_struct * fq_nmod_ctx;
+
+    T = _fq_zech_tables_map(filename);
+    if (T == NULL)
+        return 0;
+
+    fq_nmod_ctx = flint_malloc(sizeof(fq_nmod_ctx_struct));
+    fq_nmod_ctx_init_modulus(fq_nmod_ctx, T->modulus, var);
+
+    /* the file's tables are only used if none are registered already */
+    T = _fq_zech_tables_insert(T);
+
+    _fq_zech_ctx_init_fq_nmod_ctx_tables(ctx, fq_nmod_ctx, T);
+    ctx->owns_fq_nmod_ctx = 1;
+
+    return 1;
+}
@@ -0,0 +1,194 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fq_zech.h"
+#include "ulong_extras.h"
+
+#define TMP_FILE "fq_zech_tables_test"
+
+static int
+_tables_equal(const fq_zech_ctx_t a, const mp_limb_t * zech,
+                                 const mp_limb_t * prime, const mp_limb_t * ev)
+{
+    mp_limb_t q = a->qm1 + 1;
+
+    return memcmp(a->zech_log_table, zech, q*sizeof(mp_limb_t)) == 0
+        && memcmp(a->prime_field_table, prime, a->p*sizeof(mp_limb_t)) == 0
+        && memcmp(a->eval_table, ev, q*sizeof(mp_limb_t)) == 0;
+}
+
+int
+main(void)
+{
+    int i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("ctx_tables....");
+    fflush(stdout);
+
+    /* Contexts with the same modulus share their tables */
+    for (i = 0; i < 50 * flint_test_multiplier(); i++)
+    {
+        fq_zech_ctx_t a, b, c;
+        fq_zech_t x, y, z;
+        fmpz_t p;
+        slong d;
+
+        fmpz_init_set_ui(p, n_randprime(state, 2 + n_randint(state, 4), 1));
+        d = 1 + n_randint(state, 4);
+
+        fq_zech_ctx_init_conway(a, p, d, "a");
+        fq_zech_ctx_init_modulus(b, fq_zech_ctx_modulus(a), "b");
+
+        if (a->tables != b->tables || a->zech_log_table != b->zech_log_table
+                                   || a->tables->refcount != 2)
+        {
+            flint_printf("FAIL:\ncheck sharing\n");
+            abort();
+        }
+
+        /* a different modulus gets different tables */
+        if (d > 1)
+        {
+            fq_zech_ctx_init_random(c, p, d, "c");
+            if (!nmod_poly_equal(fq_zech_ctx_modulus(a),
+                                 fq_zech_ctx_modulus(c))
+                && a->tables == c->tables)
+            {
+                flint_printf("FAIL:\ncheck different moduli\n");
+                abort();
+            }
+            fq_zech_ctx_clear(c);
+        }
+
+        /* b still works once a is gone */
+        fq_zech_ctx_clear(a);
+
+        fq_zech_init(x, b);
+        fq_zech_init(y, b);
+        fq_zech_init(z, b);
+
+        fq_zech_randtest(x, state, b);
+        fq_zech_randtest(y, state, b);
+        fq_zech_add(z, x, y, b);
+        fq_zech_sub(z, z, y, b);
+
+        if (!fq_zech_equal(z, x, b) || b->tables->refcount != 1)
+        {
+            flint_printf("FAIL:\ncheck tables survive\n");
+            abort();
+        }
+
+        fq_zech_clear(x, b);
+        fq_zech_clear(y, b);
+        fq_zech_clear(z, b);
+
+        fq_zech_ctx_clear(b);
+        fmpz_clear(p);
+    }
+
+    /* Write tables to a file and map them again */
+    for (i = 0; i < 20 * flint_test_multiplier(); i++)
+    {
+        fq_zech_ctx_t a, b, c;
+        mp_limb_t * zech, * prime, * ev, q;
+        fmpz_t p;
+        slong d;
+
+        fmpz_init_set_ui(p, n_randprime(state, 2 + n_randint(state, 4), 1));
+        d = 1 + n_randint(state, 4);
+
+        fq_zech_ctx_init_random(a, p, d, "a");
+
+        q = a->qm1 + 1;
+        zech = flint_malloc(q*sizeof(mp_limb_t));
+        prime = flint_malloc(a->p*sizeof(mp_limb_t));
+        ev = flint_malloc(q*sizeof(mp_limb_t));
+        memcpy(zech, a->zech_log_table, q*sizeof(mp_limb_t));
+        memcpy(prime, a->prime_field_table, a->p*sizeof(mp_limb_t));
+        memcpy(ev, a->eval_table, q*sizeof(mp_limb_t));
+
+        if (!fq_zech_ctx_write_tables(a, TMP_FILE))
+        {
+            flint_printf("FAIL:\ncould not write " TMP_FILE "\n");
+            abort();
+        }
+
+        /* while a is alive, its tables are used rather than the file's */
+        if (!fq_zech_ctx_init_file(b, TMP_FILE, "b") || b->tables != a->tables)
+        {
+            flint_printf("FAIL:\ncheck file with registered tables\n");
+            abort();
+        }
+
+        fq_zech_ctx_clear(a);
+        fq_zech_ctx_clear(b);
+
+        if (!fq_zech_ctx_init_file(b, TMP_FILE, "b")
+            || !_tables_equal(b, zech, prime, ev)
+            || fq_zech_ctx_degree(b) != d
+            || fmpz_cmp(fq_zech_ctx_prime(b), p) != 0)
+        {
+            flint_printf("FAIL:\ncheck file contents\n");
+            abort();
+        }
+
+        /* new contexts with the same modulus pick up the file's tables */
+        fq_zech_ctx_init_modulus(c, fq_zech_ctx_modulus(b), "c");
+        if (c->tables != b->tables)
+        {
+            flint_printf("FAIL:\ncheck sharing of file tables\n");
+            abort();
+        }
+
+        fq_zech_ctx_clear(b);
+        fq_zech_ctx_clear(c);
+
+        flint_free(zech);
+        flint_free(prime);
+        flint_free(ev);
+        fmpz_clear(p);
+    }
+
+    /* Invalid files are rejected */
+    {
+        fq_zech_ctx_t a;
+        FILE * file;
+        mp_limb_t w = 0;
+
+        remove(TMP_FILE);
+        if (fq_zech_ctx_init_file(a, TMP_FILE, "a"))
+        {
+            flint_printf("FAIL:\ncheck missing file\n");
+            abort();
+        }
+
+        file = fopen(TMP_FILE, "wb");
+        fwrite(&w, sizeof(mp_limb_t), 1, file);
+        fclose(file);
+
+        if (fq_zech_ctx_init_file(a, TMP_FILE, "a"))
+        {
+            flint_printf("FAIL:\ncheck bad file\n");
+            abort();
+        }
+
+        remove(TMP_FILE);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
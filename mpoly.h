@@ -32,6 +32,7 @@
 #include "fmpz.h"
 #include "fmpq.h"
 #include "ulong_extras.h"
+#include "thread_pool.h"
 
 #ifdef __cplusplus
  extern "C" {
@@ -40,6 +41,10 @@
 
 #define MPOLY_MIN_BITS (UWORD(8))    /* minimum number of bits to pack into */
 
+#define MPOLY_RADIX_SORT_CUTOFF 768 /* sort_terms: bitwise -> byte radix */
+#define MPOLY_RADIX_SORT_THREADED_CUTOFF 65536 /* min terms per thread */
+#define MPOLY_EXP_BUILDER_THREADED_CUTOFF 8192 /* min terms per thread */
+
 typedef enum {
    ORD_LEX, ORD_DEGLEX, ORD_DEGREVLEX
 } ordering_t;
@@ -183,6 +188,41 @@ FLINT_DLL mpoly_rbnode_struct * mpoly_rbtree_get(int * new_node,
 FLINT_DLL mpoly_rbnode_struct * mpoly_rbtree_get_fmpz(int * new_node,
                                         struct mpoly_rbtree *tree, fmpz_t rcx);
 
+/* exponent builders *********************************************************/
+
+/*
+    Unpacked exponent vectors, nvars entries per monomial. They are stored
+    as words until some exponent does not fit in a word, after which all
+    of them are stored as fmpz's.
+*/
+typedef struct
+{
+    ulong * exps;
+    fmpz * fexps;
+    slong length;
+    slong alloc;
+} mpoly_exp_builder_struct;
+
+typedef mpoly_exp_builder_struct mpoly_exp_builder_t[1];
+
+FLINT_DLL void mpoly_exp_builder_init(mpoly_exp_builder_t E, slong alloc,
+                                                       const mpoly_ctx_t mctx);
+
+FLINT_DLL void mpoly_exp_builder_clear(mpoly_exp_builder_t E,
+                                                       const mpoly_ctx_t mctx);
+
+FLINT_DLL void mpoly_exp_builder_realloc(mpoly_exp_builder_t E, slong alloc,
+                                                       const mpoly_ctx_t mctx);
+
+FLINT_DLL void mpoly_exp_builder_push_ui(mpoly_exp_builder_t E,
+                     const ulong * exps, slong len, const mpoly_ctx_t mctx);
+
+FLINT_DLL void mpoly_exp_builder_push_fmpz(mpoly_exp_builder_t E,
+                      const fmpz * exps, slong len, const mpoly_ctx_t mctx);
+
+FLINT_DLL mp_bitcnt_t mpoly_exp_builder_pack(ulong ** Aexps, slong Aalloc,
+                             mpoly_exp_builder_t E, const mpoly_ctx_t mctx);
+
 /* Orderings *****************************************************************/
 
 MPOLY_INLINE
@@ -745,6 +785,13 @@ FLINT_DLL slong mpoly_gen_monomial_offset_mp(ulong * mexp, slong var,
 
 /* Monomial arrays ***********************************************************/
 
+FLINT_DLL void _mpoly_radix_sort_exps_threaded(slong * perm, ulong * exps,
+                               slong len, slong N, const ulong * cmpmask,
+                        const thread_pool_handle * handles, slong num_handles);
+
+FLINT_DLL void mpoly_radix_sort_exps(slong * perm, ulong * exps, slong len,
+                                             slong N, const ulong * cmpmask);
+
 FLINT_DLL void mpoly_get_cmpmask(ulong * cmpmask, slong N, slong bits,
                                                        const mpoly_ctx_t mctx);
 
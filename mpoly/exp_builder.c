@@ -0,0 +1,271 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "thread_pool.h"
+#include "mpoly.h"
+
+void mpoly_exp_builder_init(mpoly_exp_builder_t E, slong alloc,
+                                                        const mpoly_ctx_t mctx)
+{
+    E->exps = NULL;
+    E->fexps = NULL;
+    E->length = 0;
+    E->alloc = 0;
+
+    if (alloc > 0)
+        mpoly_exp_builder_realloc(E, alloc, mctx);
+}
+
+void mpoly_exp_builder_clear(mpoly_exp_builder_t E, const mpoly_ctx_t mctx)
+{
+    slong i;
+
+    if (E->fexps != NULL)
+    {
+        for (i = 0; i < E->alloc*mctx->nvars; i++)
+            fmpz_clear(E->fexps + i);
+        flint_free(E->fexps);
+    }
+
+    if (E->exps != NULL)
+        flint_free(E->exps);
+}
+
+/* only ever grows the allocation */
+void mpoly_exp_builder_realloc(mpoly_exp_builder_t E, slong alloc,
+                                                        const mpoly_ctx_t mctx)
+{
+    slong nvars = mctx->nvars;
+    slong old_size = E->alloc*nvars;
+    slong new_size = FLINT_MAX(alloc*nvars, 1);
+
+    if (alloc <= E->alloc)
+        return;
+
+    if (E->fexps != NULL)
+    {
+        E->fexps = (fmpz *) flint_realloc(E->fexps, new_size*sizeof(fmpz));
+        memset(E->fexps + old_size, 0, (new_size - old_size)*sizeof(fmpz));
+    }
+    else
+    {
+        E->exps = (ulong *) flint_realloc(E->exps, new_size*sizeof(ulong));
+    }
+
+    E->alloc = alloc;
+}
+
+static void _mpoly_exp_builder_fit_length(mpoly_exp_builder_t E, slong len,
+                                                        const mpoly_ctx_t mctx)
+{
+    if (len > E->alloc)
+        mpoly_exp_builder_realloc(E, FLINT_MAX(len, 2*E->alloc), mctx);
+}
+
+void mpoly_exp_builder_push_ui(mpoly_exp_builder_t E, const ulong * exps,
+                                              slong len, const mpoly_ctx_t mctx)
+{
+    slong i, nvars = mctx->nvars;
+    slong off = E->length*nvars;
+
+    _mpoly_exp_builder_fit_length(E, E->length + len, mctx);
+
+    if (E->fexps != NULL)
+    {
+        for (i = 0; i < len*nvars; i++)
+            fmpz_set_ui(E->fexps + off + i, exps[i]);
+    }
+    else
+    {
+        for (i = 0; i < len*nvars; i++)
+            E->exps[off + i] = exps[i];
+    }
+
+    E->length += len;
+}
+
+void mpoly_exp_builder_push_fmpz(mpoly_exp_builder_t E, const fmpz * exps,
+                                              slong len, const mpoly_ctx_t mctx)
+{
+    slong i, nvars = mctx->nvars;
+    slong off = E->length*nvars;
+
+    _mpoly_exp_builder_fit_length(E, E->length + len, mctx);
+
+    if (E->fexps == NULL)
+    {
+        int fits = 1;
+
+        for (i = 0; i < len*nvars; i++)
+        {
+            FLINT_ASSERT(fmpz_sgn(exps + i) >= 0);
+            if (!fmpz_abs_fits_ui(exps + i))
+            {
+                fits = 0;
+                break;
+            }
+        }
+
+        if (fits)
+        {
+            for (i = 0; i < len*nvars; i++)
+                E->exps[off + i] = fmpz_get_ui(exps + i);
+            E->length += len;
+            return;
+        }
+
+        /* switch to fmpz storage for everything */
+        E->fexps = (fmpz *) flint_calloc(FLINT_MAX(E->alloc*nvars, 1),
+                                                                sizeof(fmpz));
+        for (i = 0; i < off; i++)
+            fmpz_set_ui(E->fexps + i, E->exps[i]);
+        flint_free(E->exps);
+        E->exps = NULL;
+    }
+
+    for (i = 0; i < len*nvars; i++)
+        fmpz_set(E->fexps + off + i, exps + i);
+
+    E->length += len;
+}
+
+typedef struct
+{
+    const mpoly_exp_builder_struct * E;
+    const mpoly_ctx_struct * mctx;
+    ulong * Aexps;
+    mp_bitcnt_t bits;
+    slong start;
+    slong stop;
+}
+_pack_arg_struct;
+
+static void _bits_worker(void * varg)
+{
+    _pack_arg_struct * arg = (_pack_arg_struct *) varg;
+    const mpoly_exp_builder_struct * E = arg->E;
+    const mpoly_ctx_struct * mctx = arg->mctx;
+    slong i, nvars = mctx->nvars;
+    mp_bitcnt_t bits = 0, b;
+
+    for (i = arg->start; i < arg->stop; i++)
+    {
+        if (E->fexps != NULL)
+            b = mpoly_exp_bits_required_ffmpz(E->fexps + nvars*i, mctx);
+        else
+            b = mpoly_exp_bits_required_ui(E->exps + nvars*i, mctx);
+        bits = FLINT_MAX(bits, b);
+    }
+
+    arg->bits = bits;
+}
+
+static void _pack_worker(void * varg)
+{
+    _pack_arg_struct * arg = (_pack_arg_struct *) varg;
+    const mpoly_exp_builder_struct * E = arg->E;
+    const mpoly_ctx_struct * mctx = arg->mctx;
+    slong i, nvars = mctx->nvars;
+    slong N = mpoly_words_per_exp(arg->bits, mctx);
+
+    for (i = arg->start; i < arg->stop; i++)
+    {
+        if (E->fexps != NULL)
+            mpoly_set_monomial_ffmpz(arg->Aexps + N*i, E->fexps + nvars*i,
+                                                              arg->bits, mctx);
+        else
+            mpoly_set_monomial_ui(arg->Aexps + N*i, E->exps + nvars*i,
+                                                              arg->bits, mctx);
+    }
+}
+
+/*
+    Find the smallest valid number of bits that holds every exponent of E,
+    set *Aexps to a fresh array of Aalloc packed monomials and pack the
+    exponents of E into it. E is left empty. Both passes are split between
+    the threads of the global thread pool for long inputs.
+*/
+mp_bitcnt_t mpoly_exp_builder_pack(ulong ** Aexps, slong Aalloc,
+                               mpoly_exp_builder_t E, const mpoly_ctx_t mctx)
+{
+    slong i, N, len = E->length;
+    slong num_handles = 0;
+    thread_pool_handle * handles = NULL;
+    _pack_arg_struct * args;
+    mp_bitcnt_t bits;
+
+    FLINT_ASSERT(Aalloc >= len);
+
+    if (global_thread_pool_initialized &&
+                                  len >= 2*MPOLY_EXP_BUILDER_THREADED_CUTOFF)
+    {
+        slong max_num_handles = thread_pool_get_size(global_thread_pool);
+        max_num_handles = FLINT_MIN(max_num_handles,
+                                  len/MPOLY_EXP_BUILDER_THREADED_CUTOFF - 1);
+        if (max_num_handles > 0)
+        {
+            handles = (thread_pool_handle *) flint_malloc(max_num_handles
+                                                  *sizeof(thread_pool_handle));
+            num_handles = thread_pool_request(global_thread_pool,
+                                                    handles, max_num_handles);
+        }
+    }
+
+    args = (_pack_arg_struct *) flint_malloc((num_handles + 1)
+                                                   *sizeof(_pack_arg_struct));
+    for (i = 0; i <= num_handles; i++)
+    {
+        args[i].E = E;
+        args[i].mctx = mctx;
+        args[i].start = (len*i)/(num_handles + 1);
+        args[i].stop = (len*(i + 1))/(num_handles + 1);
+    }
+
+    for (i = 0; i < num_handles; i++)
+        thread_pool_wake(global_thread_pool, handles[i],
+                                                   _bits_worker, args + i + 1);
+    _bits_worker(args + 0);
+    for (i = 0; i < num_handles; i++)
+        thread_pool_wait(global_thread_pool, handles[i]);
+
+    bits = MPOLY_MIN_BITS;
+    for (i = 0; i <= num_handles; i++)
+        bits = FLINT_MAX(bits, args[i].bits);
+    bits = mpoly_fix_bits(bits, mctx);
+
+    N = mpoly_words_per_exp(bits, mctx);
+    *Aexps = (Aalloc > 0) ? (ulong *) flint_malloc(Aalloc*N*sizeof(ulong))
+                          : NULL;
+
+    for (i = 0; i <= num_handles; i++)
+    {
+        args[i].Aexps = *Aexps;
+        args[i].bits = bits;
+    }
+
+    for (i = 0; i < num_handles; i++)
+        thread_pool_wake(global_thread_pool, handles[i],
+                                                   _pack_worker, args + i + 1);
+    _pack_worker(args + 0);
+    for (i = 0; i < num_handles; i++)
+    {
+        thread_pool_wait(global_thread_pool, handles[i]);
+        thread_pool_give_back(global_thread_pool, handles[i]);
+    }
+
+    if (handles != NULL)
+        flint_free(handles);
+    flint_free(args);
+
+    E->length = 0;
+
+    return bits;
+}
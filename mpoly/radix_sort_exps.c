@@ -0,0 +1,246 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "thread_pool.h"
+#include "mpoly.h"
+
+/*
+    LSD radix sort on 8 bit digits. The monomials are sorted by increasing
+    value of ~(exp ^ cmpmask), read as an N word integer with the most
+    significant word last, which puts them in decreasing order. Since the
+    sort is stable, equal monomials keep their relative order. Digits that
+    are the same in every monomial are skipped.
+*/
+
+#define RADIX_BITS 8
+#define RADIX (WORD(1) << RADIX_BITS)
+#define RADIX_MASK (RADIX - 1)
+
+#define DIGIT(e, w, shift, cmpmask) \
+    (((~((e)[w] ^ (cmpmask)[w])) >> (shift)) & RADIX_MASK)
+
+typedef struct
+{
+    const ulong * exps;
+    const slong * perm;
+    ulong * exps_out;
+    slong * perm_out;
+    slong start;
+    slong stop;
+    slong N;
+    const ulong * cmpmask;
+    slong word;
+    slong shift;
+    slong count[RADIX];
+}
+_radix_arg_struct;
+
+static void
+_radix_count(_radix_arg_struct * arg)
+{
+    slong i, N = arg->N, w = arg->word, shift = arg->shift;
+    const ulong * exps = arg->exps;
+    const ulong * cmpmask = arg->cmpmask;
+    slong * count = arg->count;
+
+    for (i = 0; i < RADIX; i++)
+        count[i] = 0;
+
+    for (i = arg->start; i < arg->stop; i++)
+        count[DIGIT(exps + N*i, w, shift, cmpmask)]++;
+}
+
+/* on entry count holds the first output position for each digit */
+static void
+_radix_scatter(_radix_arg_struct * arg)
+{
+    slong i, j, N = arg->N, w = arg->word, shift = arg->shift;
+    const ulong * exps = arg->exps;
+    const ulong * cmpmask = arg->cmpmask;
+    slong * count = arg->count;
+
+    for (i = arg->start; i < arg->stop; i++)
+    {
+        slong d = DIGIT(exps + N*i, w, shift, cmpmask);
+        slong pos = count[d]++;
+
+        for (j = 0; j < N; j++)
+            arg->exps_out[N*pos + j] = exps[N*i + j];
+        arg->perm_out[pos] = arg->perm[i];
+    }
+}
+
+static void
+_radix_count_worker(void * varg)
+{
+    _radix_count((_radix_arg_struct *) varg);
+}
+
+static void
+_radix_scatter_worker(void * varg)
+{
+    _radix_scatter((_radix_arg_struct *) varg);
+}
+
+void _mpoly_radix_sort_exps_threaded(slong * perm, ulong * exps, slong len,
+                                            slong N, const ulong * cmpmask,
+                         const thread_pool_handle * handles, slong num_handles)
+{
+    slong i, j, t, w, shift, num_threads = num_handles + 1;
+    ulong * varying, * orw, * andw;
+    ulong * exps_src, * exps_dst;
+    slong * perm_src, * perm_dst;
+    _radix_arg_struct * args;
+    TMP_INIT;
+
+    for (i = 0; i < len; i++)
+        perm[i] = i;
+
+    if (len < 2)
+        return;
+
+    TMP_START;
+
+    /* find the bits that are not constant over all monomials */
+    varying = (ulong *) TMP_ALLOC(2*N*sizeof(ulong));
+    orw = varying;
+    andw = varying + N;
+    for (j = 0; j < N; j++)
+        orw[j] = 0, andw[j] = ~UWORD(0);
+    for (i = 0; i < len; i++)
+    {
+        for (j = 0; j < N; j++)
+        {
+            orw[j] |= exps[N*i + j];
+            andw[j] &= exps[N*i + j];
+        }
+    }
+    for (j = 0; j < N; j++)
+        varying[j] = orw[j] ^ andw[j];
+
+    args = (_radix_arg_struct *) flint_malloc(num_threads
+                                                 *sizeof(_radix_arg_struct));
+    exps_src = exps;
+    perm_src = perm;
+    exps_dst = (ulong *) flint_malloc(N*len*sizeof(ulong));
+    perm_dst = (slong *) flint_malloc(len*sizeof(slong));
+
+    for (t = 0; t < num_threads; t++)
+    {
+        args[t].start = (len*t)/num_threads;
+        args[t].stop = (len*(t + 1))/num_threads;
+        args[t].N = N;
+        args[t].cmpmask = cmpmask;
+    }
+
+    for (w = 0; w < N; w++)
+    {
+        for (shift = 0; shift < FLINT_BITS; shift += RADIX_BITS)
+        {
+            slong d, total;
+
+            if (((varying[w] >> shift) & RADIX_MASK) == 0)
+                continue;
+
+            for (t = 0; t < num_threads; t++)
+            {
+                args[t].exps = exps_src;
+                args[t].perm = perm_src;
+                args[t].exps_out = exps_dst;
+                args[t].perm_out = perm_dst;
+                args[t].word = w;
+                args[t].shift = shift;
+            }
+
+            for (t = 0; t < num_handles; t++)
+                thread_pool_wake(global_thread_pool, handles[t],
+                                             _radix_count_worker, args + t + 1);
+            _radix_count(args + 0);
+            for (t = 0; t < num_handles; t++)
+                thread_pool_wait(global_thread_pool, handles[t]);
+
+            /* the output for digit d from thread t follows that from t - 1 */
+            total = 0;
+            for (d = 0; d < RADIX; d++)
+            {
+                for (t = 0; t < num_threads; t++)
+                {
+                    slong c = args[t].count[d];
+                    args[t].count[d] = total;
+                    total += c;
+                }
+            }
+
+            for (t = 0; t < num_handles; t++)
+                thread_pool_wake(global_thread_pool, handles[t],
+                                           _radix_scatter_worker, args + t + 1);
+            _radix_scatter(args + 0);
+            for (t = 0; t < num_handles; t++)
+                thread_pool_wait(global_thread_pool, handles[t]);
+
+            {
+                ulong * texps = exps_src;
+                slong * tperm = perm_src;
+                exps_src = exps_dst;
+                exps_dst = texps;
+                perm_src = perm_dst;
+                perm_dst = tperm;
+            }
+        }
+    }
+
+    if (exps_src != exps)
+    {
+        flint_mpn_copyi(exps, exps_src, N*len);
+        for (i = 0; i < len; i++)
+            perm[i] = perm_src[i];
+        flint_free(exps_src);
+        flint_free(perm_src);
+    }
+    else
+    {
+        flint_free(exps_dst);
+        flint_free(perm_dst);
+    }
+
+    flint_free(args);
+
+    TMP_END;
+}
+
+void mpoly_radix_sort_exps(slong * perm, ulong * exps, slong len, slong N,
+                                                      const ulong * cmpmask)
+{
+    thread_pool_handle * handles;
+    slong i, num_handles;
+
+    if (global_thread_pool_initialized && len >= MPOLY_RADIX_SORT_THREADED_CUTOFF)
+    {
+        slong max_num_handles = thread_pool_get_size(global_thread_pool);
+        max_num_handles = FLINT_MIN(max_num_handles,
+                                    len/MPOLY_RADIX_SORT_THREADED_CUTOFF);
+        if (max_num_handles > 0)
+        {
+            handles = (thread_pool_handle *) flint_malloc(max_num_handles
+                                                  *sizeof(thread_pool_handle));
+            num_handles = thread_pool_request(global_thread_pool,
+                                                    handles, max_num_handles);
+            _mpoly_radix_sort_exps_threaded(perm, exps, len, N, cmpmask,
+                                                         handles, num_handles);
+            for (i = 0; i < num_handles; i++)
+                thread_pool_give_back(global_thread_pool, handles[i]);
+            flint_free(handles);
+            return;
+        }
+    }
+
+    _mpoly_radix_sort_exps_threaded(perm, exps, len, N, cmpmask, NULL, 0);
+}
@@ -0,0 +1,122 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "mpoly.h"
+#include "thread_pool.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong iter, i, j;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("radix_sort_exps....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 1000 * flint_test_multiplier(); iter++)
+    {
+        slong len = n_randint(state, 500);
+        slong N = n_randint(state, 3) + 1;
+        slong num_handles = 0;
+        ulong * a, * b, * cmpmask, mask;
+        slong * perm;
+        thread_pool_handle * handles = NULL;
+
+        a = (ulong *) flint_malloc((N*len + 1)*sizeof(ulong));
+        b = (ulong *) flint_malloc((N*len + 1)*sizeof(ulong));
+        cmpmask = (ulong *) flint_malloc(N*sizeof(ulong));
+        perm = (slong *) flint_malloc((len + 1)*sizeof(slong));
+
+        for (j = 0; j < N; j++)
+            cmpmask[j] = n_randtest(state);
+
+        /* few distinct values in few positions, so that there are ties */
+        mask = n_randtest(state);
+        for (i = 0; i < N*len; i++)
+            a[i] = n_randtest(state) & mask;
+        for (i = 0; i < len; i++)
+        {
+            if (i > 0 && n_randint(state, 4) == 0)
+            {
+                slong k = n_randint(state, i);
+                for (j = 0; j < N; j++)
+                    a[N*i + j] = a[N*k + j];
+            }
+        }
+
+        for (i = 0; i < N*len; i++)
+            b[i] = a[i];
+
+        if (n_randint(state, 2))
+        {
+            flint_set_num_threads(n_randint(state, 4) + 1);
+            if (global_thread_pool_initialized)
+            {
+                slong max = thread_pool_get_size(global_thread_pool);
+                handles = (thread_pool_handle *) flint_malloc(
+                                          (max + 1)*sizeof(thread_pool_handle));
+                num_handles = thread_pool_request(global_thread_pool,
+                                                               handles, max);
+            }
+            _mpoly_radix_sort_exps_threaded(perm, b, len, N, cmpmask,
+                                                         handles, num_handles);
+            for (i = 0; i < num_handles; i++)
+                thread_pool_give_back(global_thread_pool, handles[i]);
+            if (handles != NULL)
+                flint_free(handles);
+        }
+        else
+        {
+            mpoly_radix_sort_exps(perm, b, len, N, cmpmask);
+        }
+
+        for (i = 0; i < len; i++)
+        {
+            if (perm[i] < 0 || perm[i] >= len ||
+                !mpoly_monomial_equal(b + N*i, a + N*perm[i], N))
+            {
+                flint_printf("FAIL\ncheck permutation\n");
+                flint_printf("iter = %wd, i = %wd\n", iter, i);
+                flint_abort();
+            }
+
+            if (i > 0 && mpoly_monomial_lt(b + N*(i - 1), b + N*i, N, cmpmask))
+            {
+                flint_printf("FAIL\ncheck order\n");
+                flint_printf("iter = %wd, i = %wd\n", iter, i);
+                flint_abort();
+            }
+
+            if (i > 0 && mpoly_monomial_equal(b + N*(i - 1), b + N*i, N)
+                      && perm[i - 1] > perm[i])
+            {
+                flint_printf("FAIL\ncheck stability\n");
+                flint_printf("iter = %wd, i = %wd\n", iter, i);
+                flint_abort();
+            }
+        }
+
+        flint_free(a);
+        flint_free(b);
+        flint_free(cmpmask);
+        flint_free(perm);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -24,10 +24,10 @@ nmod_mat_mul(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
     k = A->c;
     n = B->c;
 
-    if (FLINT_BITS == 64 && C->mod.n < 2048)
-        cutoff = 400;
+    if (C->mod.n < 2048)
+        cutoff = FLINT_TUNE_CUTOFF(FLINT_TUNE_NMOD_MAT_MUL_STRASSEN_SMALL);
     else
-        cutoff = 200;
+        cutoff = FLINT_TUNE_CUTOFF(FLINT_TUNE_NMOD_MAT_MUL_STRASSEN);
 
     if (m < cutoff || n < cutoff || k < cutoff)
         nmod_mat_mul_classical(C, A, B);
@@ -274,6 +274,9 @@ struct nmod_mat_data
     {
         nmod_mat_init_set(inner, o.inner);
     }
+    FLINTXX_DEFINE_DATA_MOVE(nmod_mat_data,
+            nmod_mat_init(inner, 0, 0, o.inner->mod.n),
+            nmod_mat_swap(inner, o.inner))
 
     nmod_mat_data(nmod_matxx_srcref o)
     {
@@ -1399,6 +1399,37 @@ FLINT_DLL void nmod_mpoly_geobucket_pow_fmpz_inplace(nmod_mpoly_geobucket_t B1,
 FLINT_DLL int nmod_mpoly_geobucket_divides_inplace(nmod_mpoly_geobucket_t B1,
                         nmod_mpoly_geobucket_t B2, const nmod_mpoly_ctx_t ctx);
 
+/* builders ******************************************************************/
+
+typedef struct nmod_mpoly_builder
+{
+    mp_limb_t * coeffs;
+    slong alloc;
+    mpoly_exp_builder_t exps;
+} nmod_mpoly_builder_struct;
+
+typedef nmod_mpoly_builder_struct nmod_mpoly_builder_t[1];
+
+FLINT_DLL void nmod_mpoly_builder_init(nmod_mpoly_builder_t B, slong alloc,
+                                                   const nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL void nmod_mpoly_builder_clear(nmod_mpoly_builder_t B,
+                                                   const nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL void nmod_mpoly_builder_fit_length(nmod_mpoly_builder_t B,
+                                        slong len, const nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL void nmod_mpoly_builder_push_terms_ui_ui(nmod_mpoly_builder_t B,
+                          const ulong * c, const ulong * exps, slong len,
+                                                   const nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL void nmod_mpoly_builder_push_terms_ui_fmpz(nmod_mpoly_builder_t B,
+                           const ulong * c, const fmpz * exps, slong len,
+                                                   const nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL void nmod_mpoly_builder_finish(nmod_mpoly_t A,
+                           nmod_mpoly_builder_t B, const nmod_mpoly_ctx_t ctx);
+
 
 
 
@@ -0,0 +1,108 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "nmod_mpoly.h"
+
+void nmod_mpoly_builder_init(nmod_mpoly_builder_t B, slong alloc,
+                                                    const nmod_mpoly_ctx_t ctx)
+{
+    alloc = FLINT_MAX(alloc, 0);
+    B->coeffs = (alloc > 0) ? (mp_limb_t *) flint_malloc(alloc
+                                                        *sizeof(mp_limb_t))
+                            : NULL;
+    B->alloc = alloc;
+    mpoly_exp_builder_init(B->exps, alloc, ctx->minfo);
+}
+
+void nmod_mpoly_builder_clear(nmod_mpoly_builder_t B,
+                                                    const nmod_mpoly_ctx_t ctx)
+{
+    if (B->coeffs != NULL)
+        flint_free(B->coeffs);
+
+    mpoly_exp_builder_clear(B->exps, ctx->minfo);
+}
+
+void nmod_mpoly_builder_fit_length(nmod_mpoly_builder_t B, slong len,
+                                                    const nmod_mpoly_ctx_t ctx)
+{
+    slong new_alloc;
+
+    if (len <= B->alloc)
+        return;
+
+    new_alloc = FLINT_MAX(len, 2*B->alloc);
+    B->coeffs = (mp_limb_t *) flint_realloc(B->coeffs,
+                                                new_alloc*sizeof(mp_limb_t));
+    B->alloc = new_alloc;
+
+    mpoly_exp_builder_realloc(B->exps, new_alloc, ctx->minfo);
+}
+
+static void _nmod_mpoly_builder_push_coeffs(nmod_mpoly_builder_t B,
+                        const ulong * c, slong len, const nmod_mpoly_ctx_t ctx)
+{
+    slong i, old_length = B->exps->length;
+
+    nmod_mpoly_builder_fit_length(B, old_length + len, ctx);
+
+    for (i = 0; i < len; i++)
+    {
+        mp_limb_t t = c[i];
+        if (t >= ctx->ffinfo->mod.n)
+            NMOD_RED(t, t, ctx->ffinfo->mod);
+        B->coeffs[old_length + i] = t;
+    }
+}
+
+void nmod_mpoly_builder_push_terms_ui_ui(nmod_mpoly_builder_t B,
+                               const ulong * c, const ulong * exps, slong len,
+                                                    const nmod_mpoly_ctx_t ctx)
+{
+    _nmod_mpoly_builder_push_coeffs(B, c, len, ctx);
+    mpoly_exp_builder_push_ui(B->exps, exps, len, ctx->minfo);
+}
+
+void nmod_mpoly_builder_push_terms_ui_fmpz(nmod_mpoly_builder_t B,
+                                const ulong * c, const fmpz * exps, slong len,
+                                                    const nmod_mpoly_ctx_t ctx)
+{
+    _nmod_mpoly_builder_push_coeffs(B, c, len, ctx);
+    mpoly_exp_builder_push_fmpz(B->exps, exps, len, ctx->minfo);
+}
+
+/*
+    The coefficient array of B is handed over to A as is, and the exponents
+    are packed once into a fresh array at the final bit count. B is left
+    empty and may be reused.
+*/
+void nmod_mpoly_builder_finish(nmod_mpoly_t A, nmod_mpoly_builder_t B,
+                                                    const nmod_mpoly_ctx_t ctx)
+{
+    slong len = B->exps->length;
+    ulong * exps;
+    mp_bitcnt_t bits;
+
+    bits = mpoly_exp_builder_pack(&exps, B->alloc, B->exps, ctx->minfo);
+
+    nmod_mpoly_clear(A, ctx);
+    A->coeffs = B->coeffs;
+    A->exps = exps;
+    A->alloc = B->alloc;
+    A->length = len;
+    A->bits = bits;
+
+    B->coeffs = NULL;
+    B->alloc = 0;
+
+    nmod_mpoly_sort_terms(A, ctx);
+    nmod_mpoly_combine_like_terms(A, ctx);
+}
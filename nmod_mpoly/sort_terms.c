@@ -150,6 +150,27 @@ void nmod_mpoly_sort_terms(nmod_mpoly_t A, const nmod_mpoly_ctx_t ctx)
     ptempexp = (ulong *) TMP_ALLOC(N*sizeof(ulong));
     mpoly_get_cmpmask(ptempexp, N, A->bits, ctx->minfo);
 
+    if (A->length >= MPOLY_RADIX_SORT_CUTOFF)
+    {
+        slong * perm = (slong *) flint_malloc(A->length*sizeof(slong));
+        mp_limb_t * coeffs = (mp_limb_t *) flint_malloc(A->alloc*sizeof(mp_limb_t));
+
+        mpoly_radix_sort_exps(perm, A->exps, A->length, N, ptempexp);
+
+        /* move the coefficients by shallow copies */
+        for (i = 0; i < A->length; i++)
+            coeffs[i] = A->coeffs[perm[i]];
+        for ( ; i < A->alloc; i++)
+            coeffs[i] = A->coeffs[i];
+
+        flint_free(A->coeffs);
+        A->coeffs = coeffs;
+        flint_free(perm);
+
+        TMP_END;
+        return;
+    }
+
     himask = 0;
     for (i = 0; i < A->length; i++)
     {
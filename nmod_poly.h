@@ -39,12 +39,17 @@
     extern "C" {
 #endif
 
-#define NMOD_DIVREM_DIVCONQUER_CUTOFF  300
-#define NMOD_DIV_DIVCONQUER_CUTOFF     300 /* Must be <= NMOD_DIVREM_DIVCONQUER_CUTOFF */
-
-#define NMOD_POLY_HGCD_CUTOFF  100      /* HGCD: Basecase -> Recursion      */
-#define NMOD_POLY_GCD_CUTOFF  340       /* GCD:  Euclidean -> HGCD          */
-#define NMOD_POLY_SMALL_GCD_CUTOFF 200  /* GCD (small n): Euclidean -> HGCD */
+/* runtime tunable, see tuning.h */
+#define NMOD_DIVREM_DIVCONQUER_CUTOFF \
+    FLINT_TUNE_CUTOFF(FLINT_TUNE_NMOD_POLY_DIVREM_DIVCONQUER)
+#define NMOD_DIV_DIVCONQUER_CUTOFF NMOD_DIVREM_DIVCONQUER_CUTOFF
+
+#define NMOD_POLY_HGCD_CUTOFF \
+    FLINT_TUNE_CUTOFF(FLINT_TUNE_NMOD_POLY_HGCD) /* HGCD: Basecase -> Recursion */
+#define NMOD_POLY_GCD_CUTOFF \
+    FLINT_TUNE_CUTOFF(FLINT_TUNE_NMOD_POLY_GCD)  /* GCD: Euclidean -> HGCD */
+#define NMOD_POLY_SMALL_GCD_CUTOFF \
+    FLINT_TUNE_CUTOFF(FLINT_TUNE_NMOD_POLY_SMALL_GCD) /* GCD (small n) */
 
 NMOD_POLY_INLINE
 slong NMOD_DIVREM_BC_ITCH(slong lenA, slong lenB, nmod_t mod)
@@ -130,6 +135,51 @@ typedef struct
 }
 nmod_poly_compose_mod_precomp_preinv_arg_t;
 
+/*
+    Tables for number theoretic transforms modulo the word-size primes
+    _nmod_poly_ntt_primes[i], each of the form c*2^NMOD_POLY_NTT_MAX_DEPTH + 1
+    and lying in (2^(FLINT_BITS - 3), 2^(FLINT_BITS - 2)), so that butterflies
+    may work lazily on residues in [0, 4p).
+*/
+#if FLINT64
+#define NMOD_POLY_NTT_NUM_PRIMES 64
+#define NMOD_POLY_NTT_MAX_DEPTH 32
+#else
+#define NMOD_POLY_NTT_NUM_PRIMES 32
+#define NMOD_POLY_NTT_MAX_DEPTH 20
+#endif
+
+#define NMOD_POLY_NTT_PRIME_BITS (FLINT_BITS - 3)
+
+FLINT_DLL extern const mp_limb_t _nmod_poly_ntt_primes[NMOD_POLY_NTT_NUM_PRIMES];
+FLINT_DLL extern const mp_limb_t _nmod_poly_ntt_roots[NMOD_POLY_NTT_NUM_PRIMES];
+
+typedef struct
+{
+    mp_limb_t p;
+    nmod_t mod;
+    slong depth;
+    mp_ptr * tab;       /* tab[k] = [w | w_pre | iw | iw_pre], each of length
+                           2^k, where w[i] = w_{2^(k+1)}^i, iw[i] its inverse
+                           and w_pre, iw_pre the Shoup quotients */
+    mp_limb_t ninv;     /* 2^-depth mod p */
+    mp_limb_t ninv_pre;
+} nmod_poly_ntt_struct;
+
+typedef nmod_poly_ntt_struct nmod_poly_ntt_t[1];
+
+typedef struct
+{
+    mp_ptr * b;         /* transforms of poly2, one per NTT prime */
+    slong num_primes;   /* zero if no transform is stored */
+    slong depth;
+    slong len1;         /* maximum length of the other operand */
+    slong len2;
+    nmod_poly_t poly2;
+} nmod_poly_mul_precache_struct;
+
+typedef nmod_poly_mul_precache_struct nmod_poly_mul_precache_t[1];
+
 /* zn_poly helper functions  ************************************************
 
 Copyright (C) 2007, 2008 David Harvey
@@ -557,6 +607,46 @@ FLINT_DLL void _nmod_poly_mullow_KS(mp_ptr out, mp_srcptr in1, slong len1,
 FLINT_DLL void nmod_poly_mullow_KS(nmod_poly_t res, const nmod_poly_t poly1, 
                              const nmod_poly_t poly2, mp_bitcnt_t bits, slong n);
 
+FLINT_DLL void nmod_poly_ntt_init(nmod_poly_ntt_t F,
+                                                 slong prime_idx, slong depth);
+
+FLINT_DLL void nmod_poly_ntt_clear(nmod_poly_ntt_t F);
+
+FLINT_DLL void _nmod_poly_ntt_cleanup(void);
+
+FLINT_DLL void _nmod_poly_ntt(mp_ptr a, const nmod_poly_ntt_t F);
+
+FLINT_DLL void _nmod_poly_intt(mp_ptr a, const nmod_poly_ntt_t F);
+
+FLINT_DLL void _nmod_poly_ntt_pointwise_mul(mp_ptr a, mp_srcptr b,
+                                                      const nmod_poly_ntt_t F);
+
+FLINT_DLL void _nmod_poly_mul_ntt_prime(mp_ptr res, mp_srcptr poly1,
+                  slong len1, mp_srcptr poly2, slong len2, slong prime_idx);
+
+FLINT_DLL void _nmod_poly_ntt_crt(mp_ptr res, mp_srcptr r, slong len,
+                                               slong num_primes, nmod_t mod);
+
+FLINT_DLL void _nmod_poly_mul_ntt(mp_ptr res, mp_srcptr poly1, slong len1, 
+                                       mp_srcptr poly2, slong len2, nmod_t mod);
+
+FLINT_DLL void nmod_poly_mul_ntt(nmod_poly_t res, 
+                             const nmod_poly_t poly1, const nmod_poly_t poly2);
+
+FLINT_DLL void nmod_poly_mul_precache_init(nmod_poly_mul_precache_t pre,
+                                        slong len1, const nmod_poly_t poly2);
+
+FLINT_DLL void nmod_poly_mul_precache_clear(nmod_poly_mul_precache_t pre);
+
+FLINT_DLL void _nmod_poly_mullow_precache(mp_ptr res, mp_srcptr poly1,
+                 slong len1, const nmod_poly_mul_precache_t pre, slong n);
+
+FLINT_DLL void nmod_poly_mullow_precache(nmod_poly_t res,
+       const nmod_poly_t poly1, const nmod_poly_mul_precache_t pre, slong n);
+
+FLINT_DLL void nmod_poly_mul_precache(nmod_poly_t res,
+                const nmod_poly_t poly1, const nmod_poly_mul_precache_t pre);
+
 FLINT_DLL void _nmod_poly_mul(mp_ptr res, mp_srcptr poly1, slong len1, 
                                        mp_srcptr poly2, slong len2, nmod_t mod);
 
@@ -22,7 +22,7 @@ _nmod_poly_div(mp_ptr Q, mp_srcptr A, slong lenA,
 {
     TMP_INIT;
     
-    if (lenB < 15)
+    if (lenB < FLINT_TUNE_CUTOFF(FLINT_TUNE_NMOD_POLY_DIVREM_BASECASE))
     {
         mp_ptr W;
         
@@ -31,7 +31,7 @@ _nmod_poly_div(mp_ptr Q, mp_srcptr A, slong lenA,
         _nmod_poly_div_basecase(Q, W, A, lenA, B, lenB, mod);
         TMP_END;
     }
-    else if (lenB < 6000)
+    else if (lenB < FLINT_TUNE_CUTOFF(FLINT_TUNE_NMOD_POLY_DIVREM_NEWTON))
         _nmod_poly_div_divconquer(Q, A, lenA, B, lenB, mod);
     else
         _nmod_poly_div_newton(Q, A, lenA, B, lenB, mod);
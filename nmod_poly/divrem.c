@@ -28,7 +28,7 @@ _nmod_poly_divrem(mp_ptr Q, mp_ptr R, mp_srcptr A, slong lenA,
         _nmod_poly_divrem_q0(Q, R, A, B, lenB, mod);
     else if (lenA == lenB + 1)
         _nmod_poly_divrem_q1(Q, R, A, lenA, B, lenB, mod);
-    else if (lenB < 15)
+    else if (lenB < FLINT_TUNE_CUTOFF(FLINT_TUNE_NMOD_POLY_DIVREM_BASECASE))
     {
         mp_ptr W;
         
@@ -37,7 +37,7 @@ _nmod_poly_divrem(mp_ptr Q, mp_ptr R, mp_srcptr A, slong lenA,
         _nmod_poly_divrem_basecase(Q, R, W, A, lenA, B, lenB, mod);
         TMP_END;
     }
-    else if (lenB < 6000)
+    else if (lenB < FLINT_TUNE_CUTOFF(FLINT_TUNE_NMOD_POLY_DIVREM_NEWTON))
         _nmod_poly_divrem_divconquer(Q, R, A, lenA, B, lenB, mod);
     else
         _nmod_poly_divrem_newton(Q, R, A, lenA, B, lenB, mod);
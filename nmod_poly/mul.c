@@ -31,9 +31,12 @@ void _nmod_poly_mul(mp_ptr res, mp_srcptr poly1, slong len1,
 
     if (2 * bits + bits2 <= FLINT_BITS && len1 + len2 < 16)
         _nmod_poly_mul_classical(res, poly1, len1, poly2, len2, mod);
-    else if (bits * len2 > 2000)
+    else if (bits * len2 > FLINT_TUNE_CUTOFF(FLINT_TUNE_NMOD_POLY_MUL_NTT) &&
+             len1 + len2 - 1 <= (WORD(1) << NMOD_POLY_NTT_MAX_DEPTH))
+        _nmod_poly_mul_ntt(res, poly1, len1, poly2, len2, mod);
+    else if (bits * len2 > FLINT_TUNE_CUTOFF(FLINT_TUNE_NMOD_POLY_MUL_KS4))
         _nmod_poly_mul_KS4(res, poly1, len1, poly2, len2, mod);
-    else if (bits * len2 > 200)
+    else if (bits * len2 > FLINT_TUNE_CUTOFF(FLINT_TUNE_NMOD_POLY_MUL_KS2))
         _nmod_poly_mul_KS2(res, poly1, len1, poly2, len2, mod);
     else
         _nmod_poly_mul_KS(res, poly1, len1, poly2, len2, 0, mod);
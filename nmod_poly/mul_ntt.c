@@ -0,0 +1,262 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "thread_pool.h"
+
+void
+_nmod_poly_mul_ntt_prime(mp_ptr res, mp_srcptr poly1, slong len1,
+                             mp_srcptr poly2, slong len2, slong prime_idx)
+{
+    const slong rlen = len1 + len2 - 1;
+    const int squaring = (poly1 == poly2 && len1 == len2);
+    slong i, n, depth;
+    mp_limb_t p, x;
+    mp_ptr a, b;
+    nmod_poly_ntt_t F;
+
+    depth = FLINT_CLOG2(rlen);
+    n = WORD(1) << depth;
+
+    nmod_poly_ntt_init(F, prime_idx, depth);
+    p = F->p;
+
+    a = (mp_ptr) flint_malloc((squaring ? 1 : 2)*n*sizeof(mp_limb_t));
+    b = squaring ? a : a + n;
+
+    for (i = 0; i < len1; i++)
+    {
+        x = poly1[i];
+        if (x >= p)
+            NMOD_RED(x, x, F->mod);
+        a[i] = x;
+    }
+    flint_mpn_zero(a + len1, n - len1);
+    _nmod_poly_ntt(a, F);
+
+    if (!squaring)
+    {
+        for (i = 0; i < len2; i++)
+        {
+            x = poly2[i];
+            if (x >= p)
+                NMOD_RED(x, x, F->mod);
+            b[i] = x;
+        }
+        flint_mpn_zero(b + len2, n - len2);
+        _nmod_poly_ntt(b, F);
+    }
+
+    _nmod_poly_ntt_pointwise_mul(a, b, F);
+    _nmod_poly_intt(a, F);
+
+    for (i = 0; i < rlen; i++)
+        res[i] = (a[i] >= p) ? a[i] - p : a[i];
+
+    flint_free(a);
+    nmod_poly_ntt_clear(F);
+}
+
+typedef struct
+{
+    mp_ptr res;
+    mp_srcptr poly1;
+    slong len1;
+    mp_srcptr poly2;
+    slong len2;
+    slong start;
+    slong stop;
+}
+_mul_ntt_worker_arg_struct;
+
+static void
+_nmod_poly_mul_ntt_worker(void * varg)
+{
+    _mul_ntt_worker_arg_struct * arg = (_mul_ntt_worker_arg_struct *) varg;
+    slong j, rlen = arg->len1 + arg->len2 - 1;
+
+    for (j = arg->start; j < arg->stop; j++)
+        _nmod_poly_mul_ntt_prime(arg->res + j*rlen, arg->poly1, arg->len1,
+                                                 arg->poly2, arg->len2, j);
+}
+
+/* Garner reconstruction of the integer coefficients, reduced mod n */
+void
+_nmod_poly_ntt_crt(mp_ptr res, mp_srcptr r, slong len,
+                                                slong num_primes, nmod_t mod)
+{
+    slong i;
+
+    if (num_primes == 1)
+    {
+        for (i = 0; i < len; i++)
+            NMOD_RED(res[i], r[i], mod);
+    }
+    else
+    {
+        const mp_limb_t p0 = _nmod_poly_ntt_primes[0];
+        const mp_limb_t p1 = _nmod_poly_ntt_primes[1];
+        mp_limb_t c1, c2, t, v, x[3], y[2], p01[2];
+        nmod_t mod1, mod2;
+
+        nmod_init(&mod1, p1);
+        nmod_init(&mod2, _nmod_poly_ntt_primes[2]);
+        c1 = n_invmod(p0 - p1, p1);
+        umul_ppmm(p01[1], p01[0], p0, p1);
+        c2 = n_ll_mod_preinv(p01[1], p01[0], mod2.n, mod2.ninv);
+        c2 = n_invmod(c2, mod2.n);
+
+        for (i = 0; i < len; i++)
+        {
+            t = r[i];
+            v = (t >= p1) ? t - p1 : t;
+            v = nmod_sub(r[len + i], v, mod1);
+            v = nmod_mul(v, c1, mod1);
+            umul_ppmm(y[1], y[0], p0, v);
+            add_ssaaaa(y[1], y[0], y[1], y[0], 0, t);
+
+            if (num_primes == 2)
+            {
+                res[i] = n_ll_mod_preinv(y[1], y[0], mod.n, mod.ninv);
+            }
+            else
+            {
+                t = n_ll_mod_preinv(y[1], y[0], mod2.n, mod2.ninv);
+                v = nmod_sub(r[2*len + i], t, mod2);
+                v = nmod_mul(v, c2, mod2);
+                x[2] = mpn_mul_1(x, p01, 2, v);
+                x[2] += mpn_add_n(x, x, y, 2);
+                if (x[2] >= mod.n)
+                    x[2] = n_mod2_preinv(x[2], mod.n, mod.ninv);
+                res[i] = n_lll_mod_preinv(x[2], x[1], x[0], mod.n, mod.ninv);
+            }
+        }
+    }
+}
+
+void
+_nmod_poly_mul_ntt(mp_ptr res, mp_srcptr poly1, slong len1,
+                                       mp_srcptr poly2, slong len2, nmod_t mod)
+{
+    const slong rlen = len1 + len2 - 1;
+    slong i, num_primes, num_workers, num_threads;
+    mp_bitcnt_t bits;
+    mp_ptr r;
+    thread_pool_handle * handles;
+    _mul_ntt_worker_arg_struct * args;
+
+    /* the integer product has coefficients less than len2*(n - 1)^2 */
+    bits = 2*(FLINT_BITS - mod.norm) + FLINT_BIT_COUNT(len2);
+    num_primes = (bits + NMOD_POLY_NTT_PRIME_BITS - 1)/NMOD_POLY_NTT_PRIME_BITS;
+
+    FLINT_ASSERT(num_primes <= 3);
+
+    r = (mp_ptr) flint_malloc(num_primes*rlen*sizeof(mp_limb_t));
+
+    /* one prime per thread */
+    num_workers = 0;
+    handles = NULL;
+    if (global_thread_pool_initialized && num_primes > 1 && rlen > 1000)
+    {
+        handles = (thread_pool_handle *) flint_malloc((num_primes - 1)
+                                                 *sizeof(thread_pool_handle));
+        num_workers = thread_pool_request(global_thread_pool,
+                                                   handles, num_primes - 1);
+    }
+
+    num_threads = num_workers + 1;
+    args = (_mul_ntt_worker_arg_struct *) flint_malloc(num_threads
+                                         *sizeof(_mul_ntt_worker_arg_struct));
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].res = r;
+        args[i].poly1 = poly1;
+        args[i].len1 = len1;
+        args[i].poly2 = poly2;
+        args[i].len2 = len2;
+        args[i].start = (num_primes*i)/num_threads;
+        args[i].stop = (num_primes*(i + 1))/num_threads;
+    }
+
+    for (i = 0; i < num_workers; i++)
+        thread_pool_wake(global_thread_pool, handles[i],
+                                 _nmod_poly_mul_ntt_worker, &args[i + 1]);
+
+    _nmod_poly_mul_ntt_worker(&args[0]);
+
+    for (i = 0; i < num_workers; i++)
+    {
+        thread_pool_wait(global_thread_pool, handles[i]);
+        thread_pool_give_back(global_thread_pool, handles[i]);
+    }
+
+    flint_free(args);
+    if (handles != NULL)
+        flint_free(handles);
+
+    _nmod_poly_ntt_crt(res, r, rlen, num_primes, mod);
+
+    flint_free(r);
+}
+
+void
+nmod_poly_mul_ntt(nmod_poly_t res,
+                              const nmod_poly_t poly1, const nmod_poly_t poly2)
+{
+    slong len1, len2, len_out;
+
+    len1 = poly1->length;
+    len2 = poly2->length;
+
+    if (len1 == 0 || len2 == 0)
+    {
+        nmod_poly_zero(res);
+        return;
+    }
+
+    len_out = len1 + len2 - 1;
+
+    if (res == poly1 || res == poly2)
+    {
+        nmod_poly_t temp;
+
+        nmod_poly_init2_preinv(temp, poly1->mod.n, poly1->mod.ninv, len_out);
+
+        if (len1 >= len2)
+            _nmod_poly_mul_ntt(temp->coeffs, poly1->coeffs, len1,
+                                         poly2->coeffs, len2, poly1->mod);
+        else
+            _nmod_poly_mul_ntt(temp->coeffs, poly2->coeffs, len2,
+                                         poly1->coeffs, len1, poly1->mod);
+
+        nmod_poly_swap(temp, res);
+        nmod_poly_clear(temp);
+    }
+    else
+    {
+        nmod_poly_fit_length(res, len_out);
+
+        if (len1 >= len2)
+            _nmod_poly_mul_ntt(res->coeffs, poly1->coeffs, len1,
+                                         poly2->coeffs, len2, poly1->mod);
+        else
+            _nmod_poly_mul_ntt(res->coeffs, poly2->coeffs, len2,
+                                         poly1->coeffs, len1, poly1->mod);
+    }
+
+    res->length = len_out;
+    _nmod_poly_normalise(res);
+}
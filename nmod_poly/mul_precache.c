@@ -0,0 +1,191 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void
+nmod_poly_mul_precache_init(nmod_poly_mul_precache_t pre,
+                                         slong len1, const nmod_poly_t poly2)
+{
+    const slong len2 = poly2->length;
+    slong i, j, n, num_primes;
+    mp_bitcnt_t bits;
+    mp_limb_t p, x;
+    nmod_poly_ntt_t F;
+
+    nmod_poly_init2_preinv(pre->poly2, poly2->mod.n, poly2->mod.ninv, len2);
+    nmod_poly_set(pre->poly2, poly2);
+
+    pre->len1 = len1;
+    pre->len2 = len2;
+    pre->num_primes = 0;
+    pre->depth = 0;
+    pre->b = NULL;
+
+    if (len1 <= 0 || len2 == 0 ||
+        len1 + len2 - 1 > (WORD(1) << NMOD_POLY_NTT_MAX_DEPTH))
+        return;
+
+    /* as for _nmod_poly_mul_ntt */
+    bits = 2*(FLINT_BITS - poly2->mod.norm)
+         + FLINT_BIT_COUNT(FLINT_MIN(len1, len2));
+    num_primes = (bits + NMOD_POLY_NTT_PRIME_BITS - 1)/NMOD_POLY_NTT_PRIME_BITS;
+
+    pre->depth = FLINT_CLOG2(len1 + len2 - 1);
+    pre->num_primes = num_primes;
+    n = WORD(1) << pre->depth;
+
+    pre->b = (mp_ptr *) flint_malloc(num_primes*sizeof(mp_ptr));
+
+    for (j = 0; j < num_primes; j++)
+    {
+        pre->b[j] = (mp_ptr) flint_malloc(n*sizeof(mp_limb_t));
+
+        nmod_poly_ntt_init(F, j, pre->depth);
+        p = F->p;
+
+        for (i = 0; i < len2; i++)
+        {
+            x = poly2->coeffs[i];
+            if (x >= p)
+                NMOD_RED(x, x, F->mod);
+            pre->b[j][i] = x;
+        }
+        flint_mpn_zero(pre->b[j] + len2, n - len2);
+
+        _nmod_poly_ntt(pre->b[j], F);
+        nmod_poly_ntt_clear(F);
+    }
+}
+
+void
+nmod_poly_mul_precache_clear(nmod_poly_mul_precache_t pre)
+{
+    slong j;
+
+    for (j = 0; j < pre->num_primes; j++)
+        flint_free(pre->b[j]);
+
+    if (pre->b != NULL)
+        flint_free(pre->b);
+
+    nmod_poly_clear(pre->poly2);
+}
+
+void
+_nmod_poly_mullow_precache(mp_ptr res, mp_srcptr poly1, slong len1,
+                                 const nmod_poly_mul_precache_t pre, slong n)
+{
+    const slong len2 = pre->len2;
+    const nmod_t mod = pre->poly2->mod;
+    slong i, j, N;
+    mp_limb_t p, x;
+    mp_ptr a, r;
+    nmod_poly_ntt_t F;
+
+    len1 = FLINT_MIN(len1, n);
+
+    /* no transform stored or poly1 too long for it */
+    if (pre->num_primes == 0 || len1 > pre->len1)
+    {
+        if (len1 >= len2)
+            _nmod_poly_mullow(res, poly1, len1, pre->poly2->coeffs, len2, n, mod);
+        else
+            _nmod_poly_mullow(res, pre->poly2->coeffs, len2, poly1, len1, n, mod);
+        return;
+    }
+
+    N = WORD(1) << pre->depth;
+
+    a = (mp_ptr) flint_malloc((N + pre->num_primes*n)*sizeof(mp_limb_t));
+    r = a + N;
+
+    for (j = 0; j < pre->num_primes; j++)
+    {
+        nmod_poly_ntt_init(F, j, pre->depth);
+        p = F->p;
+
+        for (i = 0; i < len1; i++)
+        {
+            x = poly1[i];
+            if (x >= p)
+                NMOD_RED(x, x, F->mod);
+            a[i] = x;
+        }
+        flint_mpn_zero(a + len1, N - len1);
+
+        _nmod_poly_ntt(a, F);
+        _nmod_poly_ntt_pointwise_mul(a, pre->b[j], F);
+        _nmod_poly_intt(a, F);
+
+        for (i = 0; i < n; i++)
+            r[j*n + i] = (a[i] >= p) ? a[i] - p : a[i];
+
+        nmod_poly_ntt_clear(F);
+    }
+
+    _nmod_poly_ntt_crt(res, r, n, pre->num_primes, mod);
+
+    flint_free(a);
+}
+
+void
+nmod_poly_mullow_precache(nmod_poly_t res, const nmod_poly_t poly1,
+                                 const nmod_poly_mul_precache_t pre, slong n)
+{
+    const slong len1 = poly1->length;
+    const slong len2 = pre->len2;
+
+    if (len1 == 0 || len2 == 0 || n == 0)
+    {
+        nmod_poly_zero(res);
+        return;
+    }
+
+    n = FLINT_MIN(n, len1 + len2 - 1);
+
+    if (res == poly1)
+    {
+        nmod_poly_t t;
+        nmod_poly_init2_preinv(t, poly1->mod.n, poly1->mod.ninv, n);
+        _nmod_poly_mullow_precache(t->coeffs, poly1->coeffs, len1, pre, n);
+        nmod_poly_swap(res, t);
+        nmod_poly_clear(t);
+    }
+    else
+    {
+        nmod_poly_fit_length(res, n);
+        _nmod_poly_mullow_precache(res->coeffs, poly1->coeffs, len1, pre, n);
+    }
+
+    res->length = n;
+    _nmod_poly_normalise(res);
+}
+
+void
+nmod_poly_mul_precache(nmod_poly_t res, const nmod_poly_t poly1,
+                                           const nmod_poly_mul_precache_t pre)
+{
+    const slong len1 = poly1->length;
+    const slong len2 = pre->len2;
+
+    if (len1 == 0 || len2 == 0)
+    {
+        nmod_poly_zero(res);
+        return;
+    }
+
+    nmod_poly_mullow_precache(res, poly1, pre, len1 + len2 - 1);
+}
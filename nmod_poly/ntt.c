@@ -0,0 +1,417 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+/*
+    Primes p = c*2^NMOD_POLY_NTT_MAX_DEPTH + 1 in decreasing order, together
+    with a primitive 2^NMOD_POLY_NTT_MAX_DEPTH-th root of unity modulo each.
+*/
+#if FLINT64
+
+const mp_limb_t _nmod_poly_ntt_primes[NMOD_POLY_NTT_NUM_PRIMES] =
+{
+    UWORD(4611685941117976577), UWORD(4611685692009873409),
+    UWORD(4611685606110527489), UWORD(4611685318347718657),
+    UWORD(4611685232448372737), UWORD(4611685219563470849),
+    UWORD(4611685125074190337), UWORD(4611685090714451969),
+    UWORD(4611685039174844417), UWORD(4611685021994975233),
+    UWORD(4611684738527133697), UWORD(4611684691282493441),
+    UWORD(4611684674102624257), UWORD(4611684609678114817),
+    UWORD(4611684588203278337), UWORD(4611684274670665729),
+    UWORD(4611684098577006593), UWORD(4611683789339361281),
+    UWORD(4611683647605440513), UWORD(4611683643310473217),
+    UWORD(4611683578885963777), UWORD(4611683557411127297),
+    UWORD(4611683437152043009), UWORD(4611683282533220353),
+    UWORD(4611683157979168769), UWORD(4611682913166032897),
+    UWORD(4611682857331458049), UWORD(4611682702712635393),
+    UWORD(4611682681237798913), UWORD(4611682591043485697),
+    UWORD(4611682483669303297), UWORD(4611682165841723393),
+    UWORD(4611682084237344769), UWORD(4611681955388325889),
+    UWORD(4611681581726171137), UWORD(4611681491531857921),
+    UWORD(4611681341208002561), UWORD(4611681302553296897),
+    UWORD(4611681147934474241), UWORD(4611680937481076737),
+    UWORD(4611680903121338369), UWORD(4611680877351534593),
+    UWORD(4611680731322646529), UWORD(4611680580998791169),
+    UWORD(4611680439264870401), UWORD(4611680374840360961),
+    UWORD(4611680078487617537), UWORD(4611680074192650241),
+    UWORD(4611679996883238913), UWORD(4611679910983892993),
+    UWORD(4611679893804023809), UWORD(4611679807904677889),
+    UWORD(4611679803609710593), UWORD(4611679627516051457),
+    UWORD(4611679550206640129), UWORD(4611679507256967169),
+    UWORD(4611679305393504257), UWORD(4611679262443831297),
+    UWORD(4611679249558929409), UWORD(4611679163659583489),
+    UWORD(4611678944616251393), UWORD(4611678828652134401),
+    UWORD(4611678764227624961), UWORD(4611678734162853889)
+};
+
+const mp_limb_t _nmod_poly_ntt_roots[NMOD_POLY_NTT_NUM_PRIMES] =
+{
+    UWORD(69433692538710738), UWORD(3385523647569167919),
+    UWORD(3318345213167893729), UWORD(1987246491706964068),
+    UWORD(822924968455585315), UWORD(2469127682168071965),
+    UWORD(1285830752081625251), UWORD(183752203409188909),
+    UWORD(1921765219434798347), UWORD(1227545647024351629),
+    UWORD(1419625767280555753), UWORD(2333496873055744784),
+    UWORD(1412740095042473410), UWORD(1744787301615277891),
+    UWORD(1892334733857228946), UWORD(1097498912578000954),
+    UWORD(4072886070187700477), UWORD(694260992632473271),
+    UWORD(2937129682549285438), UWORD(733902892705309265),
+    UWORD(2814492735415149199), UWORD(4469113545505019407),
+    UWORD(802260124231727687), UWORD(1364591620262808040),
+    UWORD(3170439535044416886), UWORD(467562035637133407),
+    UWORD(2897245213038952993), UWORD(1483006352426807317),
+    UWORD(2441845749430210104), UWORD(4205508554796425389),
+    UWORD(1706969373386532637), UWORD(3200581903816233914),
+    UWORD(3174698838480727617), UWORD(4435658554110039189),
+    UWORD(2265215109136843408), UWORD(3876497104351613006),
+    UWORD(1723151487789990176), UWORD(233548603520891187),
+    UWORD(4038448730184238371), UWORD(3206536212609623516),
+    UWORD(2467354294034433290), UWORD(3761130333586122566),
+    UWORD(2472534703398739845), UWORD(2726591661292192631),
+    UWORD(4262110156144202909), UWORD(809397819001368147),
+    UWORD(500353882891617265), UWORD(3522995799754442325),
+    UWORD(494912847691707461), UWORD(1428923485654486710),
+    UWORD(2171320203344936417), UWORD(3460158032986082227),
+    UWORD(2374614874592630082), UWORD(3748356674357058887),
+    UWORD(961517075871209455), UWORD(2084243218410655423),
+    UWORD(1221106803442684380), UWORD(2687608289420849936),
+    UWORD(619264847729008209), UWORD(188963725561681397),
+    UWORD(1186664712277091183), UWORD(2301903219619880494),
+    UWORD(2707913925618817886), UWORD(1178113245933764333)
+};
+
+#else
+
+const mp_limb_t _nmod_poly_ntt_primes[NMOD_POLY_NTT_NUM_PRIMES] =
+{
+    UWORD(1053818881), UWORD(1051721729), UWORD(1045430273), UWORD(1012924417),
+    UWORD(1007681537), UWORD(1004535809), UWORD(998244353), UWORD(985661441),
+    UWORD(976224257), UWORD(975175681), UWORD(972029953), UWORD(962592769),
+    UWORD(957349889), UWORD(950009857), UWORD(943718401), UWORD(940572673),
+    UWORD(938475521), UWORD(935329793), UWORD(925892609), UWORD(924844033),
+    UWORD(919601153), UWORD(918552577), UWORD(913309697), UWORD(907018241),
+    UWORD(899678209), UWORD(897581057), UWORD(883949569), UWORD(880803841),
+    UWORD(862978049), UWORD(850395137), UWORD(833617921), UWORD(824180737)
+};
+
+const mp_limb_t _nmod_poly_ntt_roots[NMOD_POLY_NTT_NUM_PRIMES] =
+{
+    UWORD(973782742), UWORD(513054490), UWORD(36657000), UWORD(547381916),
+    UWORD(437477051), UWORD(848723745), UWORD(565042129), UWORD(289936572),
+    UWORD(663055806), UWORD(608900796), UWORD(281910293), UWORD(838129283),
+    UWORD(881219545), UWORD(568553086), UWORD(48630206), UWORD(505230317),
+    UWORD(629767060), UWORD(901130559), UWORD(905074945), UWORD(121832176),
+    UWORD(611244703), UWORD(417848856), UWORD(847388864), UWORD(877090376),
+    UWORD(735502894), UWORD(279727937), UWORD(624638753), UWORD(563802334),
+    UWORD(99302199), UWORD(844259121), UWORD(60202040), UWORD(808278610)
+};
+
+#endif
+
+/*
+    Twiddle tables are cached per thread and grown on demand; the table for
+    level k only depends on the prime, so transforms of every length share
+    them. Tables are never moved once computed.
+*/
+#if FLINT_REENTRANT && !HAVE_TLS
+#include <pthread.h>
+static pthread_once_t ntt_initialised = PTHREAD_ONCE_INIT;
+pthread_mutex_t ntt_lock;
+
+void _nmod_poly_ntt_lock_init()
+{
+   pthread_mutex_init(&ntt_lock, NULL);
+}
+#endif
+
+FLINT_TLS_PREFIX mp_ptr * _nmod_poly_ntt_tables = NULL;
+FLINT_TLS_PREFIX slong _nmod_poly_ntt_depths[NMOD_POLY_NTT_NUM_PRIMES];
+#pragma omp threadprivate(_nmod_poly_ntt_tables, _nmod_poly_ntt_depths)
+
+void
+_nmod_poly_ntt_cleanup(void)
+{
+    slong j, k;
+
+    if (_nmod_poly_ntt_tables == NULL)
+        return;
+
+    for (j = 0; j < NMOD_POLY_NTT_NUM_PRIMES; j++)
+    {
+        for (k = 0; k < _nmod_poly_ntt_depths[j]; k++)
+            flint_free(_nmod_poly_ntt_tables[j*NMOD_POLY_NTT_MAX_DEPTH + k]);
+        _nmod_poly_ntt_depths[j] = 0;
+    }
+
+    flint_free(_nmod_poly_ntt_tables);
+    _nmod_poly_ntt_tables = NULL;
+}
+
+static void
+_nmod_poly_ntt_extend(slong j, slong depth)
+{
+    const mp_limb_t p = _nmod_poly_ntt_primes[j];
+    mp_limb_t pinv = n_preinvert_limb(p);
+    mp_ptr * tab, t, u;
+    mp_limb_t r, ir;
+    slong i, k, l, m;
+
+    if (_nmod_poly_ntt_tables == NULL)
+    {
+        _nmod_poly_ntt_tables = (mp_ptr *) flint_calloc(
+            NMOD_POLY_NTT_NUM_PRIMES*NMOD_POLY_NTT_MAX_DEPTH, sizeof(mp_ptr));
+        for (i = 0; i < NMOD_POLY_NTT_NUM_PRIMES; i++)
+            _nmod_poly_ntt_depths[i] = 0;
+        flint_register_cleanup_function(_nmod_poly_ntt_cleanup);
+    }
+
+    tab = _nmod_poly_ntt_tables + j*NMOD_POLY_NTT_MAX_DEPTH;
+
+    for (k = _nmod_poly_ntt_depths[j]; k < depth; k++)
+    {
+        m = WORD(1) << k;
+        t = tab[k] = (mp_ptr) flint_malloc(4*m*sizeof(mp_limb_t));
+
+        if (k == 0)
+        {
+            t[0] = t[2] = 1;
+            t[1] = t[3] = n_mulmod_precomp_shoup(1, p);
+            continue;
+        }
+
+        /* primitive 2^(k + 1)-th root of unity and its inverse */
+        r = _nmod_poly_ntt_roots[j];
+        for (l = k + 1; l < NMOD_POLY_NTT_MAX_DEPTH; l++)
+            r = n_mulmod2_preinv(r, r, p, pinv);
+        ir = n_invmod(r, p);
+
+        /* even powers come from the previous level */
+        u = tab[k - 1];
+        for (i = 0; i < m/2; i++)
+        {
+            t[2*i] = u[i];
+            t[m + 2*i] = u[m/2 + i];
+            t[2*m + 2*i] = u[m + i];
+            t[3*m + 2*i] = u[3*m/2 + i];
+
+            t[2*i + 1] = n_mulmod2_preinv(u[i], r, p, pinv);
+            t[m + 2*i + 1] = n_mulmod_precomp_shoup(t[2*i + 1], p);
+            t[2*m + 2*i + 1] = n_mulmod2_preinv(u[m + i], ir, p, pinv);
+            t[3*m + 2*i + 1] = n_mulmod_precomp_shoup(t[2*m + 2*i + 1], p);
+        }
+    }
+
+    _nmod_poly_ntt_depths[j] = FLINT_MAX(_nmod_poly_ntt_depths[j], depth);
+}
+
+void
+nmod_poly_ntt_init(nmod_poly_ntt_t F, slong prime_idx, slong depth)
+{
+    mp_limb_t p;
+
+    if (prime_idx < 0 || prime_idx >= NMOD_POLY_NTT_NUM_PRIMES
+                      || depth < 0 || depth > NMOD_POLY_NTT_MAX_DEPTH)
+    {
+        flint_printf("Exception (nmod_poly_ntt_init). Transform too large.\n");
+        flint_abort();
+    }
+
+#if FLINT_REENTRANT && !HAVE_TLS
+    pthread_once(&ntt_initialised, _nmod_poly_ntt_lock_init);
+    pthread_mutex_lock(&ntt_lock);
+#endif
+
+    /* the top level used by a transform of length 2^depth is depth - 1 */
+    if (_nmod_poly_ntt_tables == NULL || _nmod_poly_ntt_depths[prime_idx] < depth)
+        _nmod_poly_ntt_extend(prime_idx, depth);
+
+    F->tab = _nmod_poly_ntt_tables + prime_idx*NMOD_POLY_NTT_MAX_DEPTH;
+
+#if FLINT_REENTRANT && !HAVE_TLS
+    pthread_mutex_unlock(&ntt_lock);
+#endif
+
+    p = _nmod_poly_ntt_primes[prime_idx];
+
+    F->p = p;
+    nmod_init(&F->mod, p);
+    F->depth = depth;
+    F->ninv = n_invmod((UWORD(1) << depth) % p, p);
+    F->ninv_pre = n_mulmod_precomp_shoup(F->ninv, p);
+}
+
+void
+nmod_poly_ntt_clear(nmod_poly_ntt_t F)
+{
+    /* the tables belong to the cache */
+}
+
+/*
+    Shoup multiplication without the final correction: given w < p,
+    w_pre = floor(w*2^FLINT_BITS/p) and any t, the result is congruent to
+    w*t modulo p and lies in [0, 2p).
+*/
+#define MULMOD_SHOUP_LAZY(r, w, t, w_pre, p)    \
+    do {                                        \
+        mp_limb_t __q, __lo;                    \
+        umul_ppmm(__q, __lo, (w_pre), (t));     \
+        (r) = (w)*(t) - __q*(p);                \
+        (void) __lo;                            \
+    } while (0)
+
+/* reduce x in [0, 4p) to [0, 2p) without branching */
+#define REDUCE_2P(x, p2) FLINT_MIN((x), (x) - (p2))
+
+/*
+    Decimation in frequency over a block of length 2m, entries in [0, 2p).
+    Blocks which fit comfortably in L1 are done level by level, larger blocks
+    recurse on their halves after the top level butterflies, so that the
+    subsequent levels are performed in cache.
+*/
+#define NTT_BLOCK_CUTOFF 512
+
+static void
+_ntt_dif(mp_ptr a, slong m, const nmod_poly_ntt_t F)
+{
+    const mp_limb_t p = F->p, p2 = 2*F->p;
+    mp_limb_t u, v, s, t;
+    mp_srcptr w, w_pre;
+    slong i, j, k, l;
+
+    if (m == 0)
+        return;
+
+    for (k = m, l = FLINT_BIT_COUNT(m) - 1; k >= 1; k /= 2, l--)
+    {
+        w = F->tab[l];
+        w_pre = w + k;
+
+        for (j = 0; j < 2*m; j += 2*k)
+        {
+            mp_ptr x = a + j, y = a + j + k;
+
+            u = x[0];
+            v = y[0];
+            s = u + v;
+            t = u - v + p2;
+            x[0] = REDUCE_2P(s, p2);
+            y[0] = REDUCE_2P(t, p2);
+
+            for (i = 1; i < k; i++)
+            {
+                u = x[i];
+                v = y[i];
+                s = u + v;
+                t = u - v + p2;
+                x[i] = REDUCE_2P(s, p2);
+                MULMOD_SHOUP_LAZY(y[i], w[i], t, w_pre[i], p);
+            }
+        }
+
+        if (m > NTT_BLOCK_CUTOFF)
+        {
+            _ntt_dif(a, m/2, F);
+            _ntt_dif(a + m, m/2, F);
+            return;
+        }
+    }
+}
+
+/*
+    Decimation in time over a block of length 2m, entries in [0, 2p);
+    the exact inverse of _ntt_dif up to the factor 2m.
+*/
+static void
+_ntt_dit(mp_ptr a, slong m, const nmod_poly_ntt_t F)
+{
+    const mp_limb_t p = F->p, p2 = 2*F->p;
+    mp_limb_t u, v, s, t;
+    mp_srcptr w, w_pre;
+    slong i, j, k, l;
+
+    if (m == 0)
+        return;
+
+    if (m > NTT_BLOCK_CUTOFF)
+    {
+        _ntt_dit(a, m/2, F);
+        _ntt_dit(a + m, m/2, F);
+        k = m;
+        l = FLINT_BIT_COUNT(m) - 1;
+    }
+    else
+    {
+        k = 1;
+        l = 0;
+    }
+
+    for ( ; k <= m; k *= 2, l++)
+    {
+        w = F->tab[l] + 2*k;
+        w_pre = w + k;
+
+        for (j = 0; j < 2*m; j += 2*k)
+        {
+            mp_ptr x = a + j, y = a + j + k;
+
+            u = x[0];
+            v = y[0];
+            s = u + v;
+            t = u - v + p2;
+            x[0] = REDUCE_2P(s, p2);
+            y[0] = REDUCE_2P(t, p2);
+
+            for (i = 1; i < k; i++)
+            {
+                u = x[i];
+                MULMOD_SHOUP_LAZY(v, w[i], y[i], w_pre[i], p);
+                s = u + v;
+                t = u - v + p2;
+                x[i] = REDUCE_2P(s, p2);
+                y[i] = REDUCE_2P(t, p2);
+            }
+        }
+    }
+}
+
+void
+_nmod_poly_ntt(mp_ptr a, const nmod_poly_ntt_t F)
+{
+    _ntt_dif(a, (WORD(1) << F->depth)/2, F);
+}
+
+void
+_nmod_poly_intt(mp_ptr a, const nmod_poly_ntt_t F)
+{
+    _ntt_dit(a, (WORD(1) << F->depth)/2, F);
+}
+
+void
+_nmod_poly_ntt_pointwise_mul(mp_ptr a, mp_srcptr b, const nmod_poly_ntt_t F)
+{
+    const mp_limb_t p = F->p;
+    mp_limb_t u, v, hi, lo;
+    slong i, n = WORD(1) << F->depth;
+
+    for (i = 0; i < n; i++)
+    {
+        u = (a[i] >= p) ? a[i] - p : a[i];
+        v = (b[i] >= p) ? b[i] - p : b[i];
+        umul_ppmm(hi, lo, u, v);
+        NMOD_RED2(u, hi, lo, F->mod);
+        a[i] = n_mulmod_shoup(F->ninv, u, F->ninv_pre, p);
+    }
+}
@@ -0,0 +1,112 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_precache....");
+    fflush(stdout);
+
+    /* Compare with mul, several products per precomputation */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t a1, a2, b, c;
+        nmod_poly_mul_precache_t pre;
+        slong j, maxlen;
+        mp_limb_t n = n_randtest_not_zero(state);
+
+        nmod_poly_init(a1, n);
+        nmod_poly_init(a2, n);
+        nmod_poly_init(b, n);
+        nmod_poly_init(c, n);
+
+        maxlen = n_randint(state, 1000) + 1;
+        nmod_poly_randtest(c, state, n_randint(state, 1000));
+        nmod_poly_mul_precache_init(pre, maxlen, c);
+
+        for (j = 0; j < 4; j++)
+        {
+            /* sometimes exceed the precomputed length */
+            nmod_poly_randtest(b, state, n_randint(state, maxlen + 10));
+
+            nmod_poly_mul(a1, b, c);
+            nmod_poly_mul_precache(a2, b, pre);
+
+            result = (nmod_poly_equal(a1, a2));
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("maxlen = %wd, n = %wu\n", maxlen, n);
+                nmod_poly_print(a1), flint_printf("\n\n");
+                nmod_poly_print(a2), flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        nmod_poly_mul_precache_clear(pre);
+        nmod_poly_clear(a1);
+        nmod_poly_clear(a2);
+        nmod_poly_clear(b);
+        nmod_poly_clear(c);
+    }
+
+    /* Compare mullow with mullow, aliasing the output */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t a, b, c;
+        nmod_poly_mul_precache_t pre;
+        slong trunc;
+        mp_limb_t n = n_randtest_not_zero(state);
+
+        nmod_poly_init(a, n);
+        nmod_poly_init(b, n);
+        nmod_poly_init(c, n);
+
+        nmod_poly_randtest(b, state, n_randint(state, 500));
+        nmod_poly_randtest(c, state, n_randint(state, 500));
+        trunc = n_randint(state, 1000);
+
+        nmod_poly_mul_precache_init(pre, b->length, c);
+
+        nmod_poly_mullow(a, b, c, trunc);
+        nmod_poly_mullow_precache(b, b, pre, trunc);
+
+        result = (nmod_poly_equal(a, b));
+        if (!result)
+        {
+            flint_printf("FAIL (mullow):\n");
+            nmod_poly_print(a), flint_printf("\n\n");
+            nmod_poly_print(b), flint_printf("\n\n");
+            abort();
+        }
+
+        nmod_poly_mul_precache_clear(pre);
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        nmod_poly_clear(c);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
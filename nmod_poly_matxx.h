@@ -216,6 +216,9 @@ struct nmod_poly_mat_data
     {
         nmod_poly_mat_init_set(inner, o.inner);
     }
+    FLINTXX_DEFINE_DATA_MOVE(nmod_poly_mat_data,
+            nmod_poly_mat_init(inner, 0, 0, o.inner->modulus),
+            nmod_poly_mat_swap(inner, o.inner))
 
     nmod_poly_mat_data(nmod_poly_matxx_srcref o)
     {
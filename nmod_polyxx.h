@@ -347,6 +347,9 @@ struct nmod_poly_data
                 o.inner->mod.ninv, o.inner->length);
         nmod_poly_set(inner, o.inner);
     }
+    FLINTXX_DEFINE_DATA_MOVE(nmod_poly_data,
+            nmod_poly_init_preinv(inner, o.inner->mod.n, o.inner->mod.ninv),
+            std::swap(*inner, *o.inner))
 
     nmod_poly_data(nmod_polyxx_srcref r)
     {
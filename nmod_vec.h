@@ -326,6 +326,66 @@ FLINT_DLL mp_limb_t _nmod_vec_dot(mp_srcptr vec1, mp_srcptr vec2,
 FLINT_DLL mp_limb_t _nmod_vec_dot_ptr(mp_srcptr vec1, const mp_ptr * vec2, slong offset,
     slong len, nmod_t mod, int nlimbs);
 
+/* SIMD kernels **************************************************************/
+
+/*
+   On x86-64 with GCC or clang, _nmod_vec_add, _nmod_vec_sub,
+   _nmod_vec_scalar_mul_nmod_shoup, _nmod_vec_scalar_addmul_nmod and
+   _nmod_vec_dot use AVX2 or AVX-512 kernels when the processor supports
+   them, selected at runtime. Multiplications are vectorised for moduli
+   of at most 32 bits, where products fit in a 64-bit lane.
+*/
+#if defined(__GNUC__) && (__GNUC__ >= 5 || defined(__clang__)) \
+    && defined(__x86_64__) && FLINT64
+#define NMOD_VEC_HAVE_SIMD 1
+#else
+#define NMOD_VEC_HAVE_SIMD 0
+#endif
+
+#define NMOD_VEC_SIMD_NONE   0
+#define NMOD_VEC_SIMD_AVX2   1
+#define NMOD_VEC_SIMD_AVX512 2
+
+#define NMOD_VEC_SIMD_CUTOFF 16
+
+FLINT_DLL int _nmod_vec_simd_level(void);
+
+FLINT_DLL void _nmod_vec_simd_set_level(int level);
+
+#if NMOD_VEC_HAVE_SIMD
+
+FLINT_DLL void _nmod_vec_add_avx2(mp_ptr res, mp_srcptr vec1,
+                        mp_srcptr vec2, slong len, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_sub_avx2(mp_ptr res, mp_srcptr vec1,
+                        mp_srcptr vec2, slong len, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_scalar_mul_nmod_shoup_avx2(mp_ptr res,
+                        mp_srcptr vec, slong len, mp_limb_t c, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_scalar_addmul_nmod_avx2(mp_ptr res,
+                        mp_srcptr vec, slong len, mp_limb_t c, nmod_t mod);
+
+FLINT_DLL mp_limb_t _nmod_vec_dot_avx2(mp_srcptr vec1, mp_srcptr vec2,
+                        slong len, nmod_t mod, int nlimbs);
+
+FLINT_DLL void _nmod_vec_add_avx512(mp_ptr res, mp_srcptr vec1,
+                        mp_srcptr vec2, slong len, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_sub_avx512(mp_ptr res, mp_srcptr vec1,
+                        mp_srcptr vec2, slong len, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_scalar_mul_nmod_shoup_avx512(mp_ptr res,
+                        mp_srcptr vec, slong len, mp_limb_t c, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_scalar_addmul_nmod_avx512(mp_ptr res,
+                        mp_srcptr vec, slong len, mp_limb_t c, nmod_t mod);
+
+FLINT_DLL mp_limb_t _nmod_vec_dot_avx512(mp_srcptr vec1, mp_srcptr vec2,
+                        slong len, nmod_t mod, int nlimbs);
+
+#endif
+
 
 /* discrete logs a la Pohlig - Hellman ***************************************/
 
@@ -20,6 +20,20 @@ _nmod_vec_dot(mp_srcptr vec1, mp_srcptr vec2, slong len, nmod_t mod, int nlimbs)
 {
     mp_limb_t res;
     slong i;
+
+#if NMOD_VEC_HAVE_SIMD
+    if (len >= NMOD_VEC_SIMD_CUTOFF && (nlimbs == 1 || (nlimbs == 2
+                && mod.n <= (UWORD(1) << 32) && len < (WORD(1) << 32))))
+    {
+        int level = _nmod_vec_simd_level();
+
+        if (level == NMOD_VEC_SIMD_AVX512)
+            return _nmod_vec_dot_avx512(vec1, vec2, len, mod, nlimbs);
+        else if (level == NMOD_VEC_SIMD_AVX2)
+            return _nmod_vec_dot_avx2(vec1, vec2, len, mod, nlimbs);
+    }
+#endif
+
     NMOD_VEC_DOT(res, i, len, vec1[i], vec2[i], mod, nlimbs);
     return res;
 }
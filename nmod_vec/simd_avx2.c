@@ -0,0 +1,193 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+
+#if NMOD_VEC_HAVE_SIMD
+
+#include <immintrin.h>
+
+#define AVX2 __attribute__((target("avx2")))
+
+#define LOAD(p) _mm256_loadu_si256((const __m256i *) (p))
+#define STORE(p, x) _mm256_storeu_si256((__m256i *) (p), (x))
+
+/* AVX2 has no unsigned 64-bit comparison, so compare with the sign flipped */
+#define CMPLT_EPU64(a, b, sign) \
+    _mm256_cmpgt_epi64(_mm256_xor_si256((b), (sign)), \
+                       _mm256_xor_si256((a), (sign)))
+
+/* requires n < 2^63 so that a + b does not overflow */
+AVX2 void _nmod_vec_add_avx2(mp_ptr res, mp_srcptr vec1,
+                                   mp_srcptr vec2, slong len, nmod_t mod)
+{
+    const __m256i n = _mm256_set1_epi64x(mod.n);
+    const __m256i sign = _mm256_set1_epi64x(WORD_MIN);
+    __m256i s, t;
+    slong i;
+
+    for (i = 0; i + 4 <= len; i += 4)
+    {
+        s = _mm256_add_epi64(LOAD(vec1 + i), LOAD(vec2 + i));
+        t = _mm256_sub_epi64(s, n);
+        STORE(res + i, _mm256_blendv_epi8(t, s, CMPLT_EPU64(s, n, sign)));
+    }
+
+    for ( ; i < len; i++)
+        res[i] = _nmod_add(vec1[i], vec2[i], mod);
+}
+
+AVX2 void _nmod_vec_sub_avx2(mp_ptr res, mp_srcptr vec1,
+                                   mp_srcptr vec2, slong len, nmod_t mod)
+{
+    const __m256i n = _mm256_set1_epi64x(mod.n);
+    const __m256i sign = _mm256_set1_epi64x(WORD_MIN);
+    __m256i a, b, d;
+    slong i;
+
+    for (i = 0; i + 4 <= len; i += 4)
+    {
+        a = LOAD(vec1 + i);
+        b = LOAD(vec2 + i);
+        d = _mm256_sub_epi64(a, b);
+        d = _mm256_add_epi64(d, _mm256_and_si256(CMPLT_EPU64(a, b, sign), n));
+        STORE(res + i, d);
+    }
+
+    for ( ; i < len; i++)
+        res[i] = nmod_sub(vec1[i], vec2[i], mod);
+}
+
+/*
+   Shoup multiplication by c in each lane with 32-bit precomputed quotient
+   c_pr = floor(c 2^32 / n). Requires n < 2^32 and entries of a less than
+   2^32. The result is a c mod n in [0, 2n), then fully reduced.
+*/
+static AVX2 __inline__ __m256i
+_mulmod_shoup32(__m256i a, __m256i c, __m256i c_pr, __m256i n)
+{
+    __m256i p, q, r;
+
+    p = _mm256_mul_epu32(a, c);
+    q = _mm256_srli_epi64(_mm256_mul_epu32(a, c_pr), 32);
+    r = _mm256_sub_epi64(p, _mm256_mul_epu32(q, n));
+
+    /* r < 2^33, so a signed comparison suffices */
+    return _mm256_sub_epi64(r,
+                   _mm256_andnot_si256(_mm256_cmpgt_epi64(n, r), n));
+}
+
+/* requires n < 2^32 */
+AVX2 void _nmod_vec_scalar_mul_nmod_shoup_avx2(mp_ptr res, mp_srcptr vec,
+                                         slong len, mp_limb_t c, nmod_t mod)
+{
+    const __m256i n = _mm256_set1_epi64x(mod.n);
+    const __m256i cc = _mm256_set1_epi64x(c);
+    const __m256i c_pr = _mm256_set1_epi64x((c << 32)/mod.n);
+    mp_limb_t w_pr;
+    slong i;
+
+    for (i = 0; i + 4 <= len; i += 4)
+        STORE(res + i, _mulmod_shoup32(LOAD(vec + i), cc, c_pr, n));
+
+    if (i < len)
+    {
+        w_pr = n_mulmod_precomp_shoup(c, mod.n);
+        for ( ; i < len; i++)
+            res[i] = n_mulmod_shoup(c, vec[i], w_pr, mod.n);
+    }
+}
+
+/* requires n < 2^32 */
+AVX2 void _nmod_vec_scalar_addmul_nmod_avx2(mp_ptr res, mp_srcptr vec,
+                                         slong len, mp_limb_t c, nmod_t mod)
+{
+    const __m256i n = _mm256_set1_epi64x(mod.n);
+    const __m256i cc = _mm256_set1_epi64x(c);
+    const __m256i c_pr = _mm256_set1_epi64x((c << 32)/mod.n);
+    __m256i s;
+    slong i;
+
+    for (i = 0; i + 4 <= len; i += 4)
+    {
+        s = _mm256_add_epi64(LOAD(res + i),
+                             _mulmod_shoup32(LOAD(vec + i), cc, c_pr, n));
+        s = _mm256_sub_epi64(s,
+                   _mm256_andnot_si256(_mm256_cmpgt_epi64(n, s), n));
+        STORE(res + i, s);
+    }
+
+    for ( ; i < len; i++)
+        NMOD_ADDMUL(res[i], vec[i], c, mod);
+}
+
+/* horizontal sum of the four lanes */
+static AVX2 __inline__ mp_limb_t _hsum(__m256i a)
+{
+    __m128i s = _mm_add_epi64(_mm256_castsi256_si128(a),
+                              _mm256_extracti128_si256(a, 1));
+
+    return (mp_limb_t) _mm_cvtsi128_si64(s)
+         + (mp_limb_t) _mm_extract_epi64(s, 1);
+}
+
+/*
+   Requires n <= 2^32 and either nlimbs = 1, so that the sum of the products
+   fits in a limb, or nlimbs = 2 and len < 2^32, in which case the low and
+   high halves of the products are accumulated separately.
+*/
+AVX2 mp_limb_t _nmod_vec_dot_avx2(mp_srcptr vec1, mp_srcptr vec2,
+                                       slong len, nmod_t mod, int nlimbs)
+{
+    __m256i lo = _mm256_setzero_si256(), hi = _mm256_setzero_si256(), p;
+    const __m256i mask = _mm256_set1_epi64x(UWORD(0xffffffff));
+    mp_limb_t s0, s1, t0, t1, res;
+    slong i;
+
+    if (nlimbs == 1)
+    {
+        for (i = 0; i + 4 <= len; i += 4)
+            lo = _mm256_add_epi64(lo,
+                        _mm256_mul_epu32(LOAD(vec1 + i), LOAD(vec2 + i)));
+
+        s0 = _hsum(lo);
+        for ( ; i < len; i++)
+            s0 += vec1[i]*vec2[i];
+
+        NMOD_RED(res, s0, mod);
+        return res;
+    }
+
+    for (i = 0; i + 4 <= len; i += 4)
+    {
+        p = _mm256_mul_epu32(LOAD(vec1 + i), LOAD(vec2 + i));
+        lo = _mm256_add_epi64(lo, _mm256_and_si256(p, mask));
+        hi = _mm256_add_epi64(hi, _mm256_srli_epi64(p, 32));
+    }
+
+    t0 = _hsum(lo);
+    t1 = _hsum(hi);
+    add_ssaaaa(s1, s0, t1 >> 32, t1 << 32, 0, t0);
+
+    for ( ; i < len; i++)
+    {
+        umul_ppmm(t1, t0, vec1[i], vec2[i]);
+        add_ssaaaa(s1, s0, s1, s0, t1, t0);
+    }
+
+    NMOD2_RED2(res, s1, s0, mod);
+    return res;
+}
+
+#endif
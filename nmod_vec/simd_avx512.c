@@ -0,0 +1,164 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+
+#if NMOD_VEC_HAVE_SIMD
+
+#include <immintrin.h>
+
+#define AVX512 __attribute__((target("avx512f")))
+
+#define LOAD(p) _mm512_loadu_si512((const void *) (p))
+#define STORE(p, x) _mm512_storeu_si512((void *) (p), (x))
+
+/* requires n < 2^63 so that a + b does not overflow */
+AVX512 void _nmod_vec_add_avx512(mp_ptr res, mp_srcptr vec1,
+                                   mp_srcptr vec2, slong len, nmod_t mod)
+{
+    const __m512i n = _mm512_set1_epi64(mod.n);
+    __m512i s;
+    slong i;
+
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        s = _mm512_add_epi64(LOAD(vec1 + i), LOAD(vec2 + i));
+        STORE(res + i, _mm512_min_epu64(s, _mm512_sub_epi64(s, n)));
+    }
+
+    for ( ; i < len; i++)
+        res[i] = _nmod_add(vec1[i], vec2[i], mod);
+}
+
+AVX512 void _nmod_vec_sub_avx512(mp_ptr res, mp_srcptr vec1,
+                                   mp_srcptr vec2, slong len, nmod_t mod)
+{
+    const __m512i n = _mm512_set1_epi64(mod.n);
+    __m512i a, b, d;
+    __mmask8 borrow;
+    slong i;
+
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        a = LOAD(vec1 + i);
+        b = LOAD(vec2 + i);
+        d = _mm512_sub_epi64(a, b);
+        borrow = _mm512_cmplt_epu64_mask(a, b);
+        STORE(res + i, _mm512_mask_add_epi64(d, borrow, d, n));
+    }
+
+    for ( ; i < len; i++)
+        res[i] = nmod_sub(vec1[i], vec2[i], mod);
+}
+
+/* as for the AVX2 version: n < 2^32, c_pr = floor(c 2^32 / n) */
+static AVX512 __inline__ __m512i
+_mulmod_shoup32(__m512i a, __m512i c, __m512i c_pr, __m512i n)
+{
+    __m512i p, q, r;
+
+    p = _mm512_mul_epu32(a, c);
+    q = _mm512_srli_epi64(_mm512_mul_epu32(a, c_pr), 32);
+    r = _mm512_sub_epi64(p, _mm512_mul_epu32(q, n));
+
+    return _mm512_min_epu64(r, _mm512_sub_epi64(r, n));
+}
+
+/* requires n < 2^32 */
+AVX512 void _nmod_vec_scalar_mul_nmod_shoup_avx512(mp_ptr res,
+                         mp_srcptr vec, slong len, mp_limb_t c, nmod_t mod)
+{
+    const __m512i n = _mm512_set1_epi64(mod.n);
+    const __m512i cc = _mm512_set1_epi64(c);
+    const __m512i c_pr = _mm512_set1_epi64((c << 32)/mod.n);
+    mp_limb_t w_pr;
+    slong i;
+
+    for (i = 0; i + 8 <= len; i += 8)
+        STORE(res + i, _mulmod_shoup32(LOAD(vec + i), cc, c_pr, n));
+
+    if (i < len)
+    {
+        w_pr = n_mulmod_precomp_shoup(c, mod.n);
+        for ( ; i < len; i++)
+            res[i] = n_mulmod_shoup(c, vec[i], w_pr, mod.n);
+    }
+}
+
+/* requires n < 2^32 */
+AVX512 void _nmod_vec_scalar_addmul_nmod_avx512(mp_ptr res,
+                         mp_srcptr vec, slong len, mp_limb_t c, nmod_t mod)
+{
+    const __m512i n = _mm512_set1_epi64(mod.n);
+    const __m512i cc = _mm512_set1_epi64(c);
+    const __m512i c_pr = _mm512_set1_epi64((c << 32)/mod.n);
+    __m512i s;
+    slong i;
+
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        s = _mm512_add_epi64(LOAD(res + i),
+                             _mulmod_shoup32(LOAD(vec + i), cc, c_pr, n));
+        STORE(res + i, _mm512_min_epu64(s, _mm512_sub_epi64(s, n)));
+    }
+
+    for ( ; i < len; i++)
+        NMOD_ADDMUL(res[i], vec[i], c, mod);
+}
+
+/* same requirements as _nmod_vec_dot_avx2 */
+AVX512 mp_limb_t _nmod_vec_dot_avx512(mp_srcptr vec1, mp_srcptr vec2,
+                                       slong len, nmod_t mod, int nlimbs)
+{
+    __m512i lo = _mm512_setzero_si512(), hi = _mm512_setzero_si512(), p;
+    const __m512i mask = _mm512_set1_epi64(UWORD(0xffffffff));
+    mp_limb_t s0, s1, t0, t1, res;
+    slong i;
+
+    if (nlimbs == 1)
+    {
+        for (i = 0; i + 8 <= len; i += 8)
+            lo = _mm512_add_epi64(lo,
+                        _mm512_mul_epu32(LOAD(vec1 + i), LOAD(vec2 + i)));
+
+        s0 = _mm512_reduce_add_epi64(lo);
+        for ( ; i < len; i++)
+            s0 += vec1[i]*vec2[i];
+
+        NMOD_RED(res, s0, mod);
+        return res;
+    }
+
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        p = _mm512_mul_epu32(LOAD(vec1 + i), LOAD(vec2 + i));
+        lo = _mm512_add_epi64(lo, _mm512_and_si512(p, mask));
+        hi = _mm512_add_epi64(hi, _mm512_srli_epi64(p, 32));
+    }
+
+    t0 = _mm512_reduce_add_epi64(lo);
+    t1 = _mm512_reduce_add_epi64(hi);
+    add_ssaaaa(s1, s0, t1 >> 32, t1 << 32, 0, t0);
+
+    for ( ; i < len; i++)
+    {
+        umul_ppmm(t1, t0, vec1[i], vec2[i]);
+        add_ssaaaa(s1, s0, s1, s0, t1, t0);
+    }
+
+    NMOD2_RED2(res, s1, s0, mod);
+    return res;
+}
+
+#endif
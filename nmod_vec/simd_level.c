@@ -0,0 +1,46 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+
+/* -1 until the processor has been queried */
+static int _nmod_vec_simd = -1;
+
+static int _nmod_vec_simd_detect(void)
+{
+#if NMOD_VEC_HAVE_SIMD
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f"))
+        return NMOD_VEC_SIMD_AVX512;
+
+    if (__builtin_cpu_supports("avx2"))
+        return NMOD_VEC_SIMD_AVX2;
+#endif
+
+    return NMOD_VEC_SIMD_NONE;
+}
+
+int _nmod_vec_simd_level(void)
+{
+    if (_nmod_vec_simd < 0)
+        _nmod_vec_simd = _nmod_vec_simd_detect();
+
+    return _nmod_vec_simd;
+}
+
+void _nmod_vec_simd_set_level(int level)
+{
+    _nmod_vec_simd = FLINT_MIN(level, _nmod_vec_simd_detect());
+    _nmod_vec_simd = FLINT_MAX(_nmod_vec_simd, NMOD_VEC_SIMD_NONE);
+}
@@ -0,0 +1,129 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "ulong_extras.h"
+
+/* compare every available SIMD level against the scalar code */
+int
+main(void)
+{
+    int i, level, max_level, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("simd....");
+    fflush(stdout);
+
+    max_level = _nmod_vec_simd_level();
+
+    for (i = 0; i < 2000 * flint_test_multiplier(); i++)
+    {
+        slong len = n_randint(state, 100) + 1;
+        mp_limb_t n, c, d1, d2;
+        nmod_t mod;
+        mp_ptr a, b, r1, r2;
+        int nlimbs;
+
+        switch (n_randint(state, 4))
+        {
+            case 0:
+                n = n_randint(state, 1000) + 1;
+                break;
+            case 1:
+                n = UWORD(1) << 32;
+                n -= n_randint(state, 3);
+                break;
+            case 2:
+                n = n_randtest_bits(state, n_randint(state, 32) + 1);
+                break;
+            default:
+                n = n_randtest_not_zero(state);
+        }
+
+        nmod_init(&mod, n);
+        c = n_randint(state, n);
+
+        a = _nmod_vec_init(len);
+        b = _nmod_vec_init(len);
+        r1 = _nmod_vec_init(len);
+        r2 = _nmod_vec_init(len);
+
+        _nmod_vec_randtest(a, state, len, mod);
+        _nmod_vec_randtest(b, state, len, mod);
+        if (n_randint(state, 4) == 0)
+        {
+            slong j;
+            for (j = 0; j < len; j++)
+                a[j] = b[j] = n - 1;
+        }
+        nlimbs = _nmod_vec_dot_bound_limbs(len, mod);
+
+        for (level = NMOD_VEC_SIMD_NONE + 1; level <= max_level; level++)
+        {
+            _nmod_vec_simd_set_level(NMOD_VEC_SIMD_NONE);
+
+            _nmod_vec_add(r1, a, b, len, mod);
+            _nmod_vec_simd_set_level(level);
+            _nmod_vec_add(r2, a, b, len, mod);
+            result = _nmod_vec_equal(r1, r2, len);
+
+            _nmod_vec_simd_set_level(NMOD_VEC_SIMD_NONE);
+            _nmod_vec_sub(r1, a, b, len, mod);
+            _nmod_vec_simd_set_level(level);
+            _nmod_vec_sub(r2, a, b, len, mod);
+            result = result && _nmod_vec_equal(r1, r2, len);
+
+            _nmod_vec_simd_set_level(NMOD_VEC_SIMD_NONE);
+            _nmod_vec_scalar_mul_nmod_shoup(r1, a, len, c, mod);
+            _nmod_vec_simd_set_level(level);
+            _nmod_vec_scalar_mul_nmod_shoup(r2, a, len, c, mod);
+            result = result && _nmod_vec_equal(r1, r2, len);
+
+            _nmod_vec_set(r1, b, len);
+            _nmod_vec_set(r2, b, len);
+            _nmod_vec_simd_set_level(NMOD_VEC_SIMD_NONE);
+            _nmod_vec_scalar_addmul_nmod(r1, a, len, c, mod);
+            _nmod_vec_simd_set_level(level);
+            _nmod_vec_scalar_addmul_nmod(r2, a, len, c, mod);
+            result = result && _nmod_vec_equal(r1, r2, len);
+
+            _nmod_vec_simd_set_level(NMOD_VEC_SIMD_NONE);
+            d1 = _nmod_vec_dot(a, b, len, mod, nlimbs);
+            _nmod_vec_simd_set_level(level);
+            d2 = _nmod_vec_dot(a, b, len, mod, nlimbs);
+            result = result && (d1 == d2);
+
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("level = %d, n = %wu, c = %wu, len = %wd\n",
+                                                        level, n, c, len);
+                abort();
+            }
+        }
+
+        _nmod_vec_simd_set_level(max_level);
+
+        _nmod_vec_clear(a);
+        _nmod_vec_clear(b);
+        _nmod_vec_clear(r1);
+        _nmod_vec_clear(r2);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
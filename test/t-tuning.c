@@ -0,0 +1,199 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_poly.h"
+#include "nmod_mat.h"
+
+#define TMP_FILE "t-tuning.tmp"
+
+int main(void)
+{
+   int i, j, result;
+   slong saved[FLINT_TUNE_NUM_CUTOFFS];
+   FILE * file;
+   FLINT_TEST_INIT(state);
+
+   flint_printf("tuning....");
+   fflush(stdout);
+
+   /* set, get and reset */
+   for (j = 0; j < FLINT_TUNE_NUM_CUTOFFS; j++)
+      saved[j] = flint_tune_get(j);
+
+   for (j = 0; j < FLINT_TUNE_NUM_CUTOFFS; j++)
+   {
+      flint_tune_set(j, 1000 + j);
+      result = (flint_tune_get(j) == 1000 + j
+             && FLINT_TUNE_CUTOFF(j) == 1000 + j);
+      if (!result)
+      {
+         flint_printf("FAIL:\n");
+         flint_printf("set/get %s\n", flint_tune_name(j));
+         flint_abort();
+      }
+   }
+
+   flint_tune_reset();
+
+   for (j = 0; j < FLINT_TUNE_NUM_CUTOFFS; j++)
+   {
+      result = (flint_tune_get(j) == saved[j]);
+      if (!result)
+      {
+         flint_printf("FAIL:\n");
+         flint_printf("reset %s\n", flint_tune_name(j));
+         flint_abort();
+      }
+   }
+
+   /* save and load */
+   for (j = 0; j < FLINT_TUNE_NUM_CUTOFFS; j++)
+      flint_tune_set(j, 100 + n_randint(state, 10000));
+   for (j = 0; j < FLINT_TUNE_NUM_CUTOFFS; j++)
+      saved[j] = flint_tune_get(j);
+
+   result = flint_tune_save(TMP_FILE);
+   flint_tune_reset();
+   result = result && flint_tune_load(TMP_FILE);
+   for (j = 0; j < FLINT_TUNE_NUM_CUTOFFS; j++)
+      result = result && (flint_tune_get(j) == saved[j]);
+   if (!result)
+   {
+      flint_printf("FAIL:\n");
+      flint_printf("save/load\n");
+      flint_abort();
+   }
+
+   /* comments and unknown names are ignored, malformed files rejected */
+   file = fopen(TMP_FILE, "w");
+   fprintf(file, "# comment\n\nno_such_cutoff 7\n%s 77\n",
+                 flint_tune_name(FLINT_TUNE_NMOD_POLY_GCD));
+   fclose(file);
+
+   result = flint_tune_load(TMP_FILE)
+         && flint_tune_get(FLINT_TUNE_NMOD_POLY_GCD) == 77
+         && flint_tune_get(FLINT_TUNE_NMOD_POLY_HGCD) ==
+                                           saved[FLINT_TUNE_NMOD_POLY_HGCD];
+   if (!result)
+   {
+      flint_printf("FAIL:\n");
+      flint_printf("load with comments\n");
+      flint_abort();
+   }
+
+   file = fopen(TMP_FILE, "w");
+   fprintf(file, "%s 5\n%s\n", flint_tune_name(FLINT_TUNE_NMOD_POLY_HGCD),
+                 flint_tune_name(FLINT_TUNE_NMOD_POLY_GCD));
+   fclose(file);
+
+   result = !flint_tune_load(TMP_FILE)
+         && flint_tune_get(FLINT_TUNE_NMOD_POLY_GCD) == 77
+         && flint_tune_get(FLINT_TUNE_NMOD_POLY_HGCD) ==
+                                           saved[FLINT_TUNE_NMOD_POLY_HGCD];
+   if (!result)
+   {
+      flint_printf("FAIL:\n");
+      flint_printf("malformed file accepted\n");
+      flint_abort();
+   }
+
+   remove(TMP_FILE);
+
+   /* results do not depend on the cutoffs, down to the smallest allowed */
+   for (i = 0; i < 200 * flint_test_multiplier(); i++)
+   {
+      nmod_poly_t a, b, q, r, g, p1, p2, q2, r2, g2;
+      nmod_mat_t A, B, C1, C2;
+      mp_limb_t n = n_randtest_not_zero(state);
+      slong m = n_randint(state, 12);
+
+      if (n_randint(state, 2))
+         n = n_randtest_prime(state, 0);
+
+      nmod_poly_init(a, n);
+      nmod_poly_init(b, n);
+      nmod_poly_init(q, n);
+      nmod_poly_init(r, n);
+      nmod_poly_init(g, n);
+      nmod_poly_init(p1, n);
+      nmod_poly_init(p2, n);
+      nmod_poly_init(q2, n);
+      nmod_poly_init(r2, n);
+      nmod_poly_init(g2, n);
+      nmod_mat_init(A, m, m, n);
+      nmod_mat_init(B, m, m, n);
+      nmod_mat_init(C1, m, m, n);
+      nmod_mat_init(C2, m, m, n);
+
+      nmod_poly_randtest(a, state, n_randint(state, 200));
+      do {
+         nmod_poly_randtest_monic(b, state, n_randint(state, 150) + 1);
+      } while (b->length == 0);
+      nmod_mat_randtest(A, state);
+      nmod_mat_randtest(B, state);
+
+      flint_tune_reset();
+      nmod_poly_mul(p1, a, b);
+      nmod_poly_divrem(q, r, a, b);
+      nmod_mat_mul(C1, A, B);
+      if (n_is_prime(n))
+         nmod_poly_gcd(g, a, b);
+
+      for (j = 0; j < FLINT_TUNE_NUM_CUTOFFS; j++)
+         flint_tune_set(j, n_randint(state, 2) ? 0 : n_randint(state, 100));
+
+      nmod_poly_mul(p2, a, b);
+      nmod_poly_divrem(q2, r2, a, b);
+      nmod_mat_mul(C2, A, B);
+      if (n_is_prime(n))
+         nmod_poly_gcd(g2, a, b);
+
+      result = (nmod_poly_equal(p1, p2) && nmod_poly_equal(q, q2)
+             && nmod_poly_equal(r, r2) && nmod_poly_equal(g, g2)
+             && nmod_mat_equal(C1, C2));
+      if (!result)
+      {
+         flint_printf("FAIL:\n");
+         flint_printf("n = %wu, m = %wd\n", n, m);
+         for (j = 0; j < FLINT_TUNE_NUM_CUTOFFS; j++)
+            flint_printf("%s %wd\n", flint_tune_name(j), flint_tune_get(j));
+         nmod_poly_print(a), flint_printf("\n\n");
+         nmod_poly_print(b), flint_printf("\n\n");
+         flint_abort();
+      }
+
+      nmod_poly_clear(a);
+      nmod_poly_clear(b);
+      nmod_poly_clear(q);
+      nmod_poly_clear(r);
+      nmod_poly_clear(g);
+      nmod_poly_clear(p1);
+      nmod_poly_clear(p2);
+      nmod_poly_clear(q2);
+      nmod_poly_clear(r2);
+      nmod_poly_clear(g2);
+      nmod_mat_clear(A);
+      nmod_mat_clear(B);
+      nmod_mat_clear(C1);
+      nmod_mat_clear(C2);
+   }
+
+   flint_tune_reset();
+
+   FLINT_TEST_CLEANUP(state);
+
+   flint_printf("PASS\n");
+   return 0;
+}
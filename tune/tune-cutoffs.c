@@ -0,0 +1,400 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+/*
+    Measures the algorithm crossovers listed in tuning.h on this machine
+    and prints a profile suitable for flint_tune_load, e.g.
+
+        build/tune/tune-cutoffs > flint.tune
+        FLINT_TUNE_FILE=flint.tune ./myprogram
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include <time.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "nmod_mat.h"
+#include "fmpz_poly.h"
+
+#define MIN_TIME (CLOCKS_PER_SEC/50)
+
+typedef struct
+{
+    mp_ptr a, b, r;
+    fmpz * fa, * fb, * fr;
+    slong lena;       /* length of a */
+    slong flen;       /* length of fa and fb */
+    nmod_mat_struct * A, * B, * C;
+    nmod_t mod;
+    int alg;
+} tune_arg_struct;
+
+typedef tune_arg_struct tune_arg_t[1];
+
+typedef void (*tune_fn)(tune_arg_t arg);
+
+/* seconds per call of f, repeating until at least MIN_TIME has elapsed */
+static double time_fn(tune_fn f, tune_arg_t arg)
+{
+    clock_t start, elapsed;
+    slong i, reps = 1;
+
+    while (1)
+    {
+        start = clock();
+        for (i = 0; i < reps; i++)
+            f(arg);
+        elapsed = clock() - start;
+
+        if (elapsed >= MIN_TIME)
+            return (double) elapsed/CLOCKS_PER_SEC/reps;
+
+        reps *= 2;
+    }
+}
+
+/*
+    First length in [lo, hi], stepping by a factor of about 5/4, from which
+    alg = 1 beats alg = 0 twice in a row. The setup function prepares the
+    arguments for a given length. Returns hi if there is no crossover.
+*/
+static slong crossover(void (*setup)(tune_arg_t, slong, flint_rand_t),
+            tune_fn f, tune_arg_t arg, slong lo, slong hi, flint_rand_t state)
+{
+    slong len, prev = -1;
+    double t0, t1;
+
+    for (len = lo; len <= hi; len += FLINT_MAX(len/4, 1))
+    {
+        setup(arg, len, state);
+
+        arg->alg = 0;
+        t0 = time_fn(f, arg);
+        arg->alg = 1;
+        t1 = time_fn(f, arg);
+
+        if (t1 < t0)
+        {
+            if (prev != -1)
+                return prev;
+            prev = len;
+        }
+        else
+            prev = -1;
+    }
+
+    return hi;
+}
+
+static int slong_cmp(const void * a, const void * b)
+{
+    slong x = *((const slong *) a), y = *((const slong *) b);
+    return (x > y) - (x < y);
+}
+
+/******************************************************************************
+
+    nmod_poly
+
+******************************************************************************/
+
+static void nmod_poly_setup(tune_arg_t arg, slong len, flint_rand_t state)
+{
+    slong i;
+
+    arg->a = flint_realloc(arg->a, len*sizeof(mp_limb_t));
+    arg->b = flint_realloc(arg->b, 2*len*sizeof(mp_limb_t));
+    arg->r = flint_realloc(arg->r, 4*len*sizeof(mp_limb_t));
+    arg->lena = len;
+
+    for (i = 0; i < len; i++)
+        arg->a[i] = n_randint(state, arg->mod.n);
+    for (i = 0; i < 2*len; i++)
+        arg->b[i] = n_randint(state, arg->mod.n);
+
+    /* divisors and gcd operands need nonzero leading coefficients */
+    arg->a[len - 1] = FLINT_MAX(arg->a[len - 1], 1);
+    arg->b[len] = FLINT_MAX(arg->b[len], 1);
+}
+
+/* alg chooses between algorithms mul_stage and mul_stage + 1 below */
+static int mul_stage;
+
+static void mul_fn(tune_arg_t arg)
+{
+    slong len = arg->lena;
+    int k = mul_stage + arg->alg;
+
+    if (k == 0)
+        _nmod_poly_mul_KS(arg->r, arg->b, len, arg->a, len, 0, arg->mod);
+    else if (k == 1)
+        _nmod_poly_mul_KS2(arg->r, arg->b, len, arg->a, len, arg->mod);
+    else if (k == 2)
+        _nmod_poly_mul_KS4(arg->r, arg->b, len, arg->a, len, arg->mod);
+    else
+        _nmod_poly_mul_ntt(arg->r, arg->b, len, arg->a, len, arg->mod);
+}
+
+static void tune_nmod_poly_mul(tune_arg_t arg, flint_rand_t state)
+{
+    static const int mod_bits[4] = { 8, 20, 40, FLINT_BITS - 4 };
+    static const slong lo[3] = { 2, 2, 32 };
+    static const slong hi[3] = { 1000, 10000, 100000 };
+    slong cut[4];
+    int i, j;
+
+    for (j = 0; j < 3; j++)
+    {
+        mul_stage = j;
+
+        for (i = 0; i < 4; i++)
+        {
+            slong len, bits;
+
+            nmod_init(&arg->mod, n_randprime(state, mod_bits[i], 0));
+            bits = FLINT_BITS - arg->mod.norm;
+
+            len = crossover(nmod_poly_setup, mul_fn, arg, lo[j], hi[j], state);
+            cut[i] = bits*len;
+        }
+
+        qsort(cut, 4, sizeof(slong), slong_cmp);
+        flint_tune_set(FLINT_TUNE_NMOD_POLY_MUL_KS2 + j, (cut[1] + cut[2])/2);
+    }
+}
+
+static void divrem_fn(tune_arg_t arg)
+{
+    slong lenB = arg->lena;
+
+    if (arg->alg == 0)
+        flint_tune_set(FLINT_TUNE_NMOD_POLY_DIVREM_BASECASE, WORD_MAX);
+    else
+        flint_tune_set(FLINT_TUNE_NMOD_POLY_DIVREM_BASECASE, 0);
+
+    _nmod_poly_divrem(arg->r, arg->r + 2*lenB, arg->b, 2*lenB,
+                                                  arg->a, lenB, arg->mod);
+}
+
+static void divrem_newton_fn(tune_arg_t arg)
+{
+    slong lenB = arg->lena;
+
+    if (arg->alg == 0)
+        _nmod_poly_divrem_divconquer(arg->r, arg->r + 2*lenB, arg->b, 2*lenB,
+                                                  arg->a, lenB, arg->mod);
+    else
+        _nmod_poly_divrem_newton(arg->r, arg->r + 2*lenB, arg->b, 2*lenB,
+                                                  arg->a, lenB, arg->mod);
+}
+
+static void tune_nmod_poly_divrem(tune_arg_t arg, flint_rand_t state)
+{
+    slong cut, best_cut = 0, lenB;
+    double t, best = 0.0;
+
+    nmod_init(&arg->mod, n_randprime(state, FLINT_BITS - 4, 0));
+
+    /* recursion cutoff of divconquer, which the crossover below relies on */
+    flint_tune_set(FLINT_TUNE_NMOD_POLY_DIVREM_BASECASE, 0);
+    lenB = 2000;
+    nmod_poly_setup(arg, lenB, state);
+    arg->alg = 1;
+    for (cut = 16; cut <= 1024; cut += cut/2)
+    {
+        flint_tune_set(FLINT_TUNE_NMOD_POLY_DIVREM_DIVCONQUER, cut);
+        t = time_fn(divrem_fn, arg);
+        if (best_cut == 0 || t < best)
+        {
+            best = t;
+            best_cut = cut;
+        }
+    }
+    flint_tune_set(FLINT_TUNE_NMOD_POLY_DIVREM_DIVCONQUER, best_cut);
+
+    cut = crossover(nmod_poly_setup, divrem_fn, arg, 2, 200, state);
+    flint_tune_set(FLINT_TUNE_NMOD_POLY_DIVREM_BASECASE, cut);
+
+    cut = crossover(nmod_poly_setup, divrem_newton_fn, arg, 100, 20000, state);
+    flint_tune_set(FLINT_TUNE_NMOD_POLY_DIVREM_NEWTON, cut);
+}
+
+static void gcd_fn(tune_arg_t arg)
+{
+    if (arg->alg == 0)
+        _nmod_poly_gcd_euclidean(arg->r, arg->b, arg->lena + 1,
+                                             arg->a, arg->lena, arg->mod);
+    else
+        _nmod_poly_gcd_hgcd(arg->r, arg->b, arg->lena + 1,
+                                             arg->a, arg->lena, arg->mod);
+}
+
+static void tune_nmod_poly_gcd(tune_arg_t arg, flint_rand_t state)
+{
+    slong cut, best_cut = 0;
+    double t, best = 0.0;
+
+    nmod_init(&arg->mod, n_randprime(state, FLINT_BITS - 4, 0));
+    nmod_poly_setup(arg, 3000, state);
+    arg->alg = 1;
+    for (cut = 16; cut <= 512; cut += cut/2)
+    {
+        flint_tune_set(FLINT_TUNE_NMOD_POLY_HGCD, cut);
+        t = time_fn(gcd_fn, arg);
+        if (best_cut == 0 || t < best)
+        {
+            best = t;
+            best_cut = cut;
+        }
+    }
+    flint_tune_set(FLINT_TUNE_NMOD_POLY_HGCD, best_cut);
+
+    /* the cutoffs are compared with the length of the larger operand */
+    cut = crossover(nmod_poly_setup, gcd_fn, arg, 20, 5000, state);
+    flint_tune_set(FLINT_TUNE_NMOD_POLY_GCD, cut + 1);
+
+    nmod_init(&arg->mod, n_randprime(state, 7, 0));
+    cut = crossover(nmod_poly_setup, gcd_fn, arg, 20, 5000, state);
+    flint_tune_set(FLINT_TUNE_NMOD_POLY_SMALL_GCD, cut + 1);
+}
+
+/******************************************************************************
+
+    nmod_mat
+
+******************************************************************************/
+
+static void nmod_mat_setup(tune_arg_t arg, slong len, flint_rand_t state)
+{
+    nmod_mat_clear(arg->A);
+    nmod_mat_clear(arg->B);
+    nmod_mat_clear(arg->C);
+    nmod_mat_init(arg->A, len, len, arg->mod.n);
+    nmod_mat_init(arg->B, len, len, arg->mod.n);
+    nmod_mat_init(arg->C, len, len, arg->mod.n);
+    nmod_mat_randfull(arg->A, state);
+    nmod_mat_randfull(arg->B, state);
+}
+
+static void mat_mul_fn(tune_arg_t arg)
+{
+    if (arg->alg == 0)
+        nmod_mat_mul_classical(arg->C, arg->A, arg->B);
+    else
+        nmod_mat_mul_strassen(arg->C, arg->A, arg->B);
+}
+
+static void tune_nmod_mat_mul(tune_arg_t arg, flint_rand_t state)
+{
+    slong cut;
+
+    /* strassen recurses through nmod_mat_mul, so never switch below */
+    flint_tune_set(FLINT_TUNE_NMOD_MAT_MUL_STRASSEN, WORD_MAX);
+    flint_tune_set(FLINT_TUNE_NMOD_MAT_MUL_STRASSEN_SMALL, WORD_MAX);
+
+    nmod_init(&arg->mod, 1009);
+    cut = crossover(nmod_mat_setup, mat_mul_fn, arg, 64, 1024, state);
+    flint_tune_set(FLINT_TUNE_NMOD_MAT_MUL_STRASSEN_SMALL, cut);
+
+    nmod_init(&arg->mod, n_randprime(state, FLINT_BITS - 4, 0));
+    cut = crossover(nmod_mat_setup, mat_mul_fn, arg, 64, 1024, state);
+    flint_tune_set(FLINT_TUNE_NMOD_MAT_MUL_STRASSEN, cut);
+}
+
+/******************************************************************************
+
+    fmpz_poly
+
+******************************************************************************/
+
+static void fmpz_poly_setup(tune_arg_t arg, slong len, flint_rand_t state)
+{
+    slong i;
+
+    _fmpz_vec_clear(arg->fa, arg->flen);
+    _fmpz_vec_clear(arg->fb, arg->flen);
+    _fmpz_vec_clear(arg->fr, 2*arg->flen);
+    arg->fa = _fmpz_vec_init(len);
+    arg->fb = _fmpz_vec_init(len);
+    arg->fr = _fmpz_vec_init(2*len);
+    arg->flen = len;
+
+    for (i = 0; i < len; i++)
+    {
+        fmpz_randbits(arg->fa + i, state, 100);
+        fmpz_randbits(arg->fb + i, state, 100);
+    }
+}
+
+static void fmpz_mul_fn(tune_arg_t arg)
+{
+    if (arg->alg == 0)
+        _fmpz_poly_mul(arg->fr, arg->fa, arg->flen, arg->fb, arg->flen);
+    else
+        _fmpz_poly_mul_ntt(arg->fr, arg->fa, arg->flen, arg->fb, arg->flen);
+}
+
+static void tune_fmpz_poly_mul(tune_arg_t arg, flint_rand_t state)
+{
+    slong cut;
+
+    flint_tune_set(FLINT_TUNE_FMPZ_POLY_MUL_NTT, WORD_MAX);
+    cut = crossover(fmpz_poly_setup, fmpz_mul_fn, arg, 64, 8192, state);
+    flint_tune_set(FLINT_TUNE_FMPZ_POLY_MUL_NTT, cut);
+}
+
+int
+main(void)
+{
+    tune_arg_t arg;
+    nmod_mat_t A, B, C;
+
+    FLINT_TEST_INIT(state);
+
+    arg->a = arg->b = arg->r = NULL;
+    arg->fa = arg->fb = arg->fr = NULL;
+    arg->lena = arg->flen = 0;
+    nmod_mat_init(A, 0, 0, 2);
+    nmod_mat_init(B, 0, 0, 2);
+    nmod_mat_init(C, 0, 0, 2);
+    arg->A = A;
+    arg->B = B;
+    arg->C = C;
+
+    flint_printf("# FLINT cutoffs -- autogenerated by tune-cutoffs\n");
+    fflush(stdout);
+
+    tune_nmod_poly_mul(arg, state);
+    tune_nmod_poly_divrem(arg, state);
+    tune_nmod_poly_gcd(arg, state);
+    tune_nmod_mat_mul(arg, state);
+    tune_fmpz_poly_mul(arg, state);
+
+    flint_tune_fprint(stdout);
+
+    flint_free(arg->a);
+    flint_free(arg->b);
+    flint_free(arg->r);
+    _fmpz_vec_clear(arg->fa, arg->flen);
+    _fmpz_vec_clear(arg->fb, arg->flen);
+    _fmpz_vec_clear(arg->fr, 2*arg->flen);
+    nmod_mat_clear(A);
+    nmod_mat_clear(B);
+    nmod_mat_clear(C);
+
+    FLINT_TEST_CLEANUP(state);
+
+    return 0;
+}
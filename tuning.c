@@ -0,0 +1,177 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "flint.h"
+
+#if FLINT64
+#define NMOD_MAT_MUL_STRASSEN_SMALL_DEFAULT 400
+#else
+#define NMOD_MAT_MUL_STRASSEN_SMALL_DEFAULT 200
+#endif
+
+#define FLINT_TUNE_DEFAULTS                                  \
+   {                                                         \
+      200,                  /* nmod_poly_mul_ks2 */          \
+      2000,                 /* nmod_poly_mul_ks4 */          \
+      200000,               /* nmod_poly_mul_ntt */          \
+      15,                   /* nmod_poly_divrem_basecase */  \
+      6000,                 /* nmod_poly_divrem_newton */    \
+      300,                  /* nmod_poly_divrem_divconquer */\
+      100,                  /* nmod_poly_hgcd */             \
+      340,                  /* nmod_poly_gcd */              \
+      200,                  /* nmod_poly_small_gcd */        \
+      200,                  /* nmod_mat_mul_strassen */      \
+      NMOD_MAT_MUL_STRASSEN_SMALL_DEFAULT,                   \
+      1024                  /* fmpz_poly_mul_ntt */          \
+   }
+
+static const slong flint_tune_defaults[FLINT_TUNE_NUM_CUTOFFS] =
+   FLINT_TUNE_DEFAULTS;
+
+slong flint_tune_cutoffs[FLINT_TUNE_NUM_CUTOFFS] = FLINT_TUNE_DEFAULTS;
+
+static const char * flint_tune_names[FLINT_TUNE_NUM_CUTOFFS] =
+{
+   "nmod_poly_mul_ks2",
+   "nmod_poly_mul_ks4",
+   "nmod_poly_mul_ntt",
+   "nmod_poly_divrem_basecase",
+   "nmod_poly_divrem_newton",
+   "nmod_poly_divrem_divconquer",
+   "nmod_poly_hgcd",
+   "nmod_poly_gcd",
+   "nmod_poly_small_gcd",
+   "nmod_mat_mul_strassen",
+   "nmod_mat_mul_strassen_small",
+   "fmpz_poly_mul_ntt"
+};
+
+/*
+   smallest values for which the algorithms terminate; strassen hands
+   products with a dimension at most 4 back to nmod_mat_mul
+*/
+static const slong flint_tune_minima[FLINT_TUNE_NUM_CUTOFFS] =
+   { 0, 0, 0, 2, 2, 2, 2, 1, 1, 5, 5, 0 };
+
+const char * flint_tune_name(flint_tune_t c)
+{
+   return flint_tune_names[c];
+}
+
+slong flint_tune_get(flint_tune_t c)
+{
+   return flint_tune_cutoffs[c];
+}
+
+void flint_tune_set(flint_tune_t c, slong value)
+{
+   flint_tune_cutoffs[c] = FLINT_MAX(value, flint_tune_minima[c]);
+}
+
+void flint_tune_reset(void)
+{
+   slong i;
+
+   for (i = 0; i < FLINT_TUNE_NUM_CUTOFFS; i++)
+      flint_tune_cutoffs[i] = flint_tune_defaults[i];
+}
+
+/*
+   Reads lines of the form "name value"; blank lines and lines starting
+   with '#' are ignored, as are unknown names so that profiles remain
+   usable across versions. Returns 0 if the file cannot be read or is
+   malformed, in which case no cutoffs are changed.
+*/
+int flint_tune_load(const char * filename)
+{
+   FILE * file;
+   char line[256], name[128];
+   slong values[FLINT_TUNE_NUM_CUTOFFS];
+   long value;
+   int i, ok = 1;
+
+   file = fopen(filename, "r");
+   if (file == NULL)
+      return 0;
+
+   for (i = 0; i < FLINT_TUNE_NUM_CUTOFFS; i++)
+      values[i] = flint_tune_cutoffs[i];
+
+   while (ok && fgets(line, sizeof(line), file) != NULL)
+   {
+      if (line[0] == '#' || line[0] == '\n' || line[0] == '\r')
+         continue;
+
+      if (sscanf(line, "%127s %ld", name, &value) != 2)
+      {
+         ok = 0;
+         break;
+      }
+
+      for (i = 0; i < FLINT_TUNE_NUM_CUTOFFS; i++)
+      {
+         if (strcmp(name, flint_tune_names[i]) == 0)
+            values[i] = FLINT_MAX(value, flint_tune_minima[i]);
+      }
+   }
+
+   fclose(file);
+
+   if (ok)
+   {
+      for (i = 0; i < FLINT_TUNE_NUM_CUTOFFS; i++)
+         flint_tune_cutoffs[i] = values[i];
+   }
+
+   return ok;
+}
+
+int flint_tune_fprint(FILE * file)
+{
+   slong i;
+   int r = 0;
+
+   for (i = 0; i < FLINT_TUNE_NUM_CUTOFFS && r >= 0; i++)
+      r = flint_fprintf(file, "%s %wd\n", flint_tune_names[i],
+                                               flint_tune_cutoffs[i]);
+
+   return r >= 0;
+}
+
+int flint_tune_save(const char * filename)
+{
+   FILE * file;
+   int ok;
+
+   file = fopen(filename, "w");
+   if (file == NULL)
+      return 0;
+
+   ok = flint_tune_fprint(file);
+
+   return (fclose(file) == 0) && ok;
+}
+
+#if defined(__GNUC__)
+
+/* load the profile named by FLINT_TUNE_FILE, if any, at startup */
+static void __attribute__((constructor)) _flint_tune_load_env(void)
+{
+   const char * filename = getenv("FLINT_TUNE_FILE");
+
+   if (filename != NULL && filename[0] != '\0')
+      flint_tune_load(filename);
+}
+
+#endif
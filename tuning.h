@@ -0,0 +1,55 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TUNING_H
+#define TUNING_H
+
+/*
+    Algorithm cutoffs which may be changed at runtime, either directly or
+    by loading a profile written by tune/tune-cutoffs. Cutoffs should only
+    be changed while no other thread is using FLINT.
+*/
+typedef enum
+{
+   FLINT_TUNE_NMOD_POLY_MUL_KS2,         /* bits*len2: KS -> KS2 */
+   FLINT_TUNE_NMOD_POLY_MUL_KS4,         /* bits*len2: KS2 -> KS4 */
+   FLINT_TUNE_NMOD_POLY_MUL_NTT,         /* bits*len2: KS4 -> NTT */
+   FLINT_TUNE_NMOD_POLY_DIVREM_BASECASE, /* lenB: basecase -> divconquer */
+   FLINT_TUNE_NMOD_POLY_DIVREM_NEWTON,   /* lenB: divconquer -> Newton */
+   FLINT_TUNE_NMOD_POLY_DIVREM_DIVCONQUER, /* lenB: divconquer recursion */
+   FLINT_TUNE_NMOD_POLY_HGCD,            /* HGCD: basecase -> recursion */
+   FLINT_TUNE_NMOD_POLY_GCD,             /* GCD: Euclidean -> HGCD */
+   FLINT_TUNE_NMOD_POLY_SMALL_GCD,       /* GCD (n < 2^8): Euclidean -> HGCD */
+   FLINT_TUNE_NMOD_MAT_MUL_STRASSEN,     /* dimension: classical -> Strassen */
+   FLINT_TUNE_NMOD_MAT_MUL_STRASSEN_SMALL, /* as above for n < 2^11 */
+   FLINT_TUNE_FMPZ_POLY_MUL_NTT,         /* len2: KS/SS -> NTT */
+   FLINT_TUNE_NUM_CUTOFFS
+} flint_tune_t;
+
+FLINT_DLL extern slong flint_tune_cutoffs[FLINT_TUNE_NUM_CUTOFFS];
+
+#define FLINT_TUNE_CUTOFF(c) (flint_tune_cutoffs[c])
+
+FLINT_DLL const char * flint_tune_name(flint_tune_t c);
+
+FLINT_DLL slong flint_tune_get(flint_tune_t c);
+
+FLINT_DLL void flint_tune_set(flint_tune_t c, slong value);
+
+FLINT_DLL void flint_tune_reset(void);
+
+FLINT_DLL int flint_tune_load(const char * filename);
+
+FLINT_DLL int flint_tune_save(const char * filename);
+
+FLINT_DLL int flint_tune_fprint(FILE * file);
+
+#endif
@@ -368,6 +368,8 @@ FLINT_DLL int n_is_prime_pocklington(ulong n, ulong iterations);
 
 FLINT_DLL int n_is_prime(ulong n);
 
+FLINT_DLL void n_is_prime_vec(int * res, const ulong * n, slong len);
+
 FLINT_DLL ulong n_nth_prime(ulong n);
 
 FLINT_DLL void n_nth_prime_bounds(ulong *lo, ulong *hi, ulong n);
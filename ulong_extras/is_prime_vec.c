@@ -0,0 +1,202 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+/* number of base 2 tests run side by side */
+#define N_IS_PRIME_VEC_LANES 4
+
+/*
+    The trial division of n_is_prime. Returns 0 or 1 if this decides the
+    primality of n and -1 otherwise.
+*/
+static int
+_n_is_prime_trial(ulong n)
+{
+    if (n < 11) {
+        if (n == 2 || n == 3 || n == 5 || n == 7)   return 1;
+        else                                        return 0;
+    }
+    if (!(n%2) || !(n%3) || !(n%5) || !(n%7))       return 0;
+    if (n <  121) /* 11*11 */                       return 1;
+    if (!(n%11) || !(n%13) || !(n%17) || !(n%19) ||
+        !(n%23) || !(n%29) || !(n%31) || !(n%37) ||
+        !(n%41) || !(n%43) || !(n%47) || !(n%53))   return 0;
+    if (n < 3481) /* 59*59 */                       return 1;
+    if (n > 1000000 &&
+        (!(n% 59) || !(n% 61) || !(n% 67) || !(n% 71) || !(n% 73) ||
+         !(n% 79) || !(n% 83) || !(n% 89) || !(n% 97) || !(n%101) ||
+         !(n%103) || !(n%107) || !(n%109) || !(n%113) || !(n%127) ||
+         !(n%131) || !(n%137) || !(n%139) || !(n%149)))  return 0;
+
+    return -1;
+}
+
+/*
+    As n_mulmod_preinv, with a and b both shifted left by norm bits and
+    the result shifted likewise. Inlined so that the multiplications of the
+    different lanes can be interleaved.
+*/
+static __inline__ ulong
+_n_mulmod_shifted(ulong a, ulong b, ulong n, ulong ninv, ulong norm)
+{
+    ulong q0, q1, r, p_hi, p_lo;
+
+    a >>= norm;
+    umul_ppmm(p_hi, p_lo, a, b);
+
+    umul_ppmm(q1, q0, ninv, p_hi);
+    add_ssaaaa(q1, q0, q1, q0, p_hi, p_lo);
+
+    r = (p_lo - (q1 + 1) * n);
+
+    if (r > q0)
+        r += n;
+
+    return (r < n ? r : r - n);
+}
+
+/*
+    Strong probable prime test to base 2 for the odd n[0], ..., n[num - 1],
+    all at least 5. The powerings 2^d mod n are done together, one bit of
+    the exponents at a time; as the base is 2, the multiplication steps are
+    just modular doublings. Entries of res whose n fails are set to 0.
+*/
+static void
+_n_is_strong_probabprime2_lanes(int * res, const ulong * n, slong num)
+{
+    ulong nn[N_IS_PRIME_VEC_LANES], ninv[N_IS_PRIME_VEC_LANES];
+    ulong norm[N_IS_PRIME_VEC_LANES], d[N_IS_PRIME_VEC_LANES];
+    ulong y[N_IS_PRIME_VEC_LANES];
+    unsigned int s[N_IS_PRIME_VEC_LANES];
+    ulong one, nm1;
+    slong j, b, bits = 0;
+
+    for (j = 0; j < N_IS_PRIME_VEC_LANES; j++)
+    {
+        /* unused lanes repeat the first number */
+        ulong m = n[j < num ? j : 0];
+
+        count_leading_zeros(norm[j], m);
+        nn[j] = m << norm[j];
+        ninv[j] = n_preinvert_limb(m);
+        d[j] = m - 1;
+        count_trailing_zeros(s[j], d[j]);
+        d[j] >>= s[j];
+        y[j] = UWORD(1) << norm[j];
+        bits = FLINT_MAX(bits, FLINT_BIT_COUNT(d[j]));
+    }
+
+    for (b = bits - 1; b >= 0; b--)
+    {
+        for (j = 0; j < N_IS_PRIME_VEC_LANES; j++)
+            y[j] = _n_mulmod_shifted(y[j], y[j], nn[j], ninv[j], norm[j]);
+
+        for (j = 0; j < N_IS_PRIME_VEC_LANES; j++)
+        {
+            if ((d[j] >> b) & 1)
+                y[j] = (y[j] >= nn[j] - y[j]) ? y[j] - (nn[j] - y[j])
+                                              : y[j] + y[j];
+        }
+    }
+
+    for (j = 0; j < num; j++)
+    {
+        unsigned int i;
+
+        one = UWORD(1) << norm[j];
+        nm1 = nn[j] - one;
+
+        if (y[j] == one || y[j] == nm1)
+            continue;
+
+        for (i = 1; i < s[j]; i++)
+        {
+            y[j] = _n_mulmod_shifted(y[j], y[j], nn[j], ninv[j], norm[j]);
+            if (y[j] == nm1 || y[j] == one)
+                break;
+        }
+
+        if (y[j] != nm1)
+            res[j] = 0;
+    }
+}
+
+void
+n_is_prime_vec(int * res, const ulong * n, slong len)
+{
+    slong i, j, num;
+    slong * idx;
+    ulong * cand;
+    int * pass;
+
+    idx = (slong *) flint_malloc(len*sizeof(slong));
+
+    /* trial division, small numbers are looked up directly */
+    num = 0;
+    for (i = 0; i < len; i++)
+    {
+        res[i] = _n_is_prime_trial(n[i]);
+
+        if (res[i] < 0)
+        {
+            if (n[i] < FLINT_PRIMES_TAB_DEFAULT_CUTOFF)
+                res[i] = n_is_probabprime(n[i]);
+            else
+                idx[num++] = i;
+        }
+    }
+
+    cand = (ulong *) flint_malloc((num + N_IS_PRIME_VEC_LANES)*sizeof(ulong));
+    pass = (int *) flint_malloc((num + N_IS_PRIME_VEC_LANES)*sizeof(int));
+
+    for (i = 0; i < num; i++)
+    {
+        cand[i] = n[idx[i]];
+        pass[i] = 1;
+    }
+
+    /* base 2 strong probable prime test, which removes most composites */
+    for (i = 0; i < num; i += N_IS_PRIME_VEC_LANES)
+        _n_is_strong_probabprime2_lanes(pass + i, cand + i,
+                                     FLINT_MIN(N_IS_PRIME_VEC_LANES, num - i));
+
+    /*
+        The survivors get the remaining half of n_is_probabprime_BPSW (the
+        base 2 test done here is at least as strong as the Fermat test used
+        there for n = 3, 7 mod 10), or n_is_probabprime if that does not go
+        through BPSW.
+    */
+    for (i = 0; i < num; i++)
+    {
+        j = idx[i];
+
+        if (!pass[i])
+            res[j] = 0;
+#if FLINT64
+        else if (cand[i] >= UWORD(1050535501))
+        {
+            if ((cand[i] % 10) == 3 || (cand[i] % 10) == 7)
+                res[j] = n_is_probabprime_fibonacci(cand[i]);
+            else
+                res[j] = (n_is_probabprime_lucas(cand[i]) == 1);
+        }
+#endif
+        else
+            res[j] = n_is_probabprime(cand[i]);
+    }
+
+    flint_free(pass);
+    flint_free(cand);
+    flint_free(idx);
+}
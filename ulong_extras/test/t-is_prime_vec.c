@@ -0,0 +1,84 @@
+/*
+    Copyright (C) 2026 The FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+/* strong pseudoprimes to base 2 */
+mp_limb_t spsp2[] = {
+    UWORD(2047), UWORD(3277), UWORD(4033), UWORD(4681), UWORD(8321),
+    UWORD(1373653), UWORD(25326001), UWORD(3215031751)
+#if FLINT64
+    , UWORD(4294967297), UWORD(2152302898747), UWORD(3474749660383),
+    UWORD(341550071728321), UWORD(3825123056546413051)
+#endif
+};
+
+int main(void)
+{
+    slong i, j;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("is_prime_vec....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        slong len = n_randint(state, 100);
+        mp_limb_t * n = flint_malloc((len + 1)*sizeof(mp_limb_t));
+        int * res = flint_malloc((len + 1)*sizeof(int));
+
+        for (j = 0; j < len; j++)
+        {
+            ulong bits = n_randint(state, FLINT_BITS) + 1;
+
+            switch (n_randint(state, 4))
+            {
+                case 0:
+                    n[j] = n_randtest_bits(state, bits);
+                    break;
+                case 1:
+                    n[j] = n_randprime(state, FLINT_MAX(bits, 2), 0);
+                    break;
+                case 2:
+                    bits = FLINT_MAX(bits/2, 2);
+                    n[j] = n_randprime(state, bits, 0);
+                    n[j] *= n_randprime(state, bits, 0);
+                    break;
+                default:
+                    n[j] = spsp2[n_randint(state,
+                                          sizeof(spsp2)/sizeof(mp_limb_t))];
+            }
+        }
+
+        n_is_prime_vec(res, n, len);
+
+        for (j = 0; j < len; j++)
+        {
+            if (res[j] != n_is_prime(n[j]))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("n = %wu, res = %d\n", n[j], res[j]);
+                abort();
+            }
+        }
+
+        flint_free(n);
+        flint_free(res);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}